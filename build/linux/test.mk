@@ -5,3 +5,39 @@ bin/tests
 bin/tests: $(TESTS_DEPENDENCIES) | bin
 	$(GPP) -o $@ $^
 	bin/tests
+
+
+#	Compares the size of the optimized test binary with
+#	and without the cold overflow path and branch hints
+
+SIZE_GPP=$(filter-out $(OPTIMIZATION),$(GPP)) -O2
+
+
+size: \
+bin/tests_size \
+bin/tests_size_nohints
+	size $^
+
+
+bin/tests_size: src/test/main.cpp | bin
+	$(SIZE_GPP) -o $@ $<
+
+
+bin/tests_size_nohints: src/test/main.cpp | bin
+	$(SIZE_GPP) -DSAFE_NO_HINTS -o $@ $<
+
+
+.PHONY: size
+
+
+#	Checks that the checked operations may be evaluated at
+#	compile time, which requires C++14
+
+CONSTEXPR_GPP=$(filter-out -std=c++11,$(GPP)) -std=c++14
+
+
+constexpr: src/test/constexpr.cpp
+	$(CONSTEXPR_GPP) -fsyntax-only $<
+
+
+.PHONY: constexpr
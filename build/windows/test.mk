@@ -5,3 +5,39 @@ bin/tests.exe
 bin/tests.exe: $(TESTS_DEPENDENCIES) | bin
 	$(GPP) -o $@ $^
 	bin/tests.exe
+
+
+#	Compares the size of the optimized test binary with
+#	and without the cold overflow path and branch hints
+
+SIZE_GPP=$(filter-out $(OPTIMIZATION),$(GPP)) -O2
+
+
+size: \
+bin/tests_size.exe \
+bin/tests_size_nohints.exe
+	size $^
+
+
+bin/tests_size.exe: src/test/main.cpp | bin
+	$(SIZE_GPP) -o $@ $<
+
+
+bin/tests_size_nohints.exe: src/test/main.cpp | bin
+	$(SIZE_GPP) -DSAFE_NO_HINTS -o $@ $<
+
+
+.PHONY: size
+
+
+#	Checks that the checked operations may be evaluated at
+#	compile time, which requires C++14
+
+CONSTEXPR_GPP=$(filter-out -std=gnu++11,$(GPP)) -std=gnu++14
+
+
+constexpr: src/test/constexpr.cpp
+	$(CONSTEXPR_GPP) -fsyntax-only $<
+
+
+.PHONY: constexpr
@@ -6,430 +6,593 @@
 #pragma once
 
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
 
+/**
+ *	\cond
+ */
+
+
+//	Detects compiler support for the checked arithmetic
+//	builtins (i.e. __builtin_mul_overflow et cetera)
+//
+//	Defining SAFE_NO_BUILTINS forces the portable
+//	implementations to be used instead
+#ifndef SAFE_NO_BUILTINS
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow) && __has_builtin(__builtin_mul_overflow)
+#define SAFE_BUILTINS
+#endif
+#elif defined(__GNUC__) && !defined(__clang__) && (__GNUC__>=5)
+#define SAFE_BUILTINS
+#endif
+#endif
+
+
+//	Branch prediction and code placement hints for the
+//	paths on which overflow is detected
+//
+//	Defining SAFE_NO_HINTS disables them
+#if !defined(SAFE_NO_HINTS) && defined(__GNUC__)
+#define SAFE_COLD __attribute__((noinline,cold))
+#define SAFE_UNLIKELY(x) __builtin_expect(!!(x),0)
+#elif !defined(SAFE_NO_HINTS) && defined(_MSC_VER)
+#define SAFE_COLD __declspec(noinline)
+#define SAFE_UNLIKELY(x) (x)
+#else
+#define SAFE_COLD
+#define SAFE_UNLIKELY(x) (x)
+#endif
+
+
+//	Marks functions which may only be constexpr given
+//	the relaxed restrictions of C++14
+#if __cplusplus>=201402L
+#define SAFE_CONSTEXPR14 constexpr
+#else
+#define SAFE_CONSTEXPR14
+#endif
+
+
+//	Terminates the program abnormally as quickly as possible
+#if defined(__GNUC__)
+#define SAFE_TRAP() __builtin_trap()
+#else
+#define SAFE_TRAP() std::abort()
+#endif
+
+
+//	Detects compiler support for 128 bit integers
+//
+//	Defining SAFE_NO_INT128 prevents them from being used
+#if !defined(SAFE_NO_INT128) && defined(__SIZEOF_INT128__)
+#define SAFE_INT128
+#endif
+
+
+/**
+ *	\endcond
+ */
+
+
 namespace Safe {
 
 
 	/**
-	 *	\cond
+	 *	The operations which may cause an integer value
+	 *	to go out of range.
 	 */
-
-
-	[[noreturn]]
-	inline void Raise () {
-	
-		throw std::overflow_error("Integer value out of range");
-	
-	}
-	
-	
-	template <typename B, typename A, typename=void>
-	class NoThrowConvertible : public std::false_type {	};
-	
-	
-	template <typename B, typename A>
-	class NoThrowConvertible<
-		B,
-		A,
-		typename std::enable_if<
-			((std::is_signed<A>::value==std::is_signed<B>::value) && (sizeof(B)>=sizeof(A))) ||
-			(std::is_unsigned<A>::value && std::is_signed<B>::value && (sizeof(B)>sizeof(A)))
-		>::type
-	> : public std::true_type {	};
-	
-	
-	//	-	A signed, B signed, B>=A
-	//	-	A unsigned, B unsigned, B>=A
-	//	-	A unsigned, B signed, B>A
-	//
-	//	Unconditionally true
-	template <typename B, typename A>
-	constexpr typename std::enable_if<
-		NoThrowConvertible<B,A>::value,
-		bool
-	>::type InRange (A) noexcept {
-	
-		return true;
-	
-	}
-	
-	
-	//	-	A signed, B signed, B<A
-	//
-	//	Checks min and max of B to ensure integer is
-	//	bounded by both
-	template <typename B, typename A>
-	constexpr typename std::enable_if<
-		std::is_signed<A>::value && std::is_signed<B>::value && (sizeof(B)<sizeof(A)),
-		bool
-	>::type InRange (A i) noexcept {
-	
-		return (i<=static_cast<A>(std::numeric_limits<B>::max())) && (i>=static_cast<A>(std::numeric_limits<B>::min()));
-	
-	}
-	
-	
-	//	-	A unsigned, B unsigned, B<A
-	//
-	//	Checks max of B to ensure integer is bounded
-	template <typename B, typename A>
-	constexpr typename std::enable_if<
-		std::is_unsigned<A>::value && std::is_unsigned<B>::value && (sizeof(B)<sizeof(A)),
-		bool
-	>::type InRange (A i) noexcept {
-	
-		return i<=static_cast<A>(std::numeric_limits<B>::max());
-	
-	}
-	
-	
-	//	-	A signed, B unsigned
-	//
-	//	False when integer is negative, otherwise passes through to:
-	//
-	//	-	A unsigned, B unsigned
-	template <typename B, typename A>
-	constexpr typename std::enable_if<
-		std::is_signed<A>::value && std::is_unsigned<B>::value,
-		bool
-	>::type InRange (A i) noexcept {
-	
-		return (i<0) ? false : InRange<B>(static_cast<typename std::make_unsigned<A>::type>(i));
-	
-	}
-	
-	
-	//	-	A unsigned, B signed, B<=A
-	//
-	//	True if integer is less than max of B
-	template <typename B, typename A>
-	constexpr typename std::enable_if<
-		std::is_unsigned<A>::value && std::is_signed<B>::value && (sizeof(B)<=sizeof(A)),
-		bool
-	>::type InRange (A i) noexcept {
-	
-		return i<=static_cast<A>(std::numeric_limits<B>::max());
-	
-	}
-	
-	
-	template <typename T>
-	constexpr typename std::enable_if<std::is_unsigned<T>::value,bool>::type IsNegative (T) noexcept {
-	
-		return false;
-	
-	}
-	
-	
-	template <typename T>
-	constexpr typename std::enable_if<std::is_signed<T>::value,bool>::type IsNegative (T i) noexcept {
-	
-		return i<0;
+	enum class Operation {
+	
+		Add,
+		Subtract,
+		Multiply,
+		Divide,
+		Modulus,
+		Negate,
+		Abs,
+		Cast,
+		Expression,
+		MultiplyAdd,
+		MultiplySubtract,
+		Sum,
+		Product,
+		MultiplyDivide,
+		Power,
+		SquareRoot,
+		Logarithm,
+		BitCount,
+		ShiftLeft,
+		ShiftRight,
+		Range,
+		Midpoint,
+		Difference,
+		Align,
+		RoundToMultiple
 	
-	}
+	};
 	
 	
-	template <typename T, typename=void>
-	class Arithmetic {
+	/**
+	 *	The type of exception thrown when an integer value
+	 *	goes out of range.
+	 *
+	 *	Throwing does not allocate: The message is shared
+	 *	between all instances, and a description of the
+	 *	operation is formatted into a buffer within the
+	 *	exception when it's created, so that what may be
+	 *	called from several threads at once.
+	 */
+	class OverflowError : public std::overflow_error {
 	
 	
-		private:
+		public:
 		
 		
-			static constexpr T max=std::numeric_limits<T>::max();
-			
+			/**
+			 *	Describes an operand of the operation which
+			 *	went out of range.
+			 */
+			class Operand {
 			
-			static void division_check (T a, T b) {
 			
-				//	Integer division always makes numbers smaller, since
-				//	there are no fractions
-				//
-				//	Therefore, the only dangerous condition is division
-				//	by zero
+				private:
+				
+				
+					std::uintmax_t bits;
+					std::size_t width;
+					bool is_signed;
 				
-				if (b==0) Raise();
+				
+				public:
+				
+				
+					constexpr Operand () noexcept : bits(0), width(0), is_signed(false) {	}
+					
+					
+					/**
+					 *	Describes an integer.
+					 *
+					 *	\tparam T
+					 *		The type of integer.
+					 *
+					 *	\param [in] i
+					 *		The integer.
+					 */
+					template <typename T>
+					constexpr Operand (T i) noexcept
+						:	bits(static_cast<typename std::make_unsigned<T>::type>(i)),
+							width(std::numeric_limits<T>::digits+(std::is_signed<T>::value ? 1 : 0)),
+							is_signed(std::is_signed<T>::value)
+					{	}
+					
+					
+					/**
+					 *	Retrieves the bit pattern of the operand.
+					 *
+					 *	\return
+					 *		The bits of the operand, zero extended.
+					 */
+					constexpr std::uintmax_t Get () const noexcept {
+					
+						return bits;
+					
+					}
+					
+					
+					/**
+					 *	Retrieves the width of the operand's type.
+					 *
+					 *	\return
+					 *		The width in bits.
+					 */
+					constexpr std::size_t Width () const noexcept {
+					
+						return width;
+					
+					}
+					
+					
+					/**
+					 *	Determines whether the operand's type is
+					 *	signed.
+					 *
+					 *	\return
+					 *		\em true if the operand is signed, \em false
+					 *		otherwise.
+					 */
+					constexpr bool Signed () const noexcept {
+					
+						return is_signed;
+					
+					}
 			
-			}
+			
+			};
 		
 		
-		public:
+		private:
 		
 		
-			static T Add (T a, T b) {
+			static const std::overflow_error & message () {
 			
-				//	If either value is zero, addition cannot
-				//	overflow
-				if (a==0) return b;
-				if (b==0) return a;
-				
-				//	If the distance between the maximum value and
-				//	a is less than b, then adding b to a will cross
-				//	that distance and then some -- i.e. an overflow
-				if ((max-a)<b) Raise();
+				//	Copying a standard exception shares its message,
+				//	so only this copy ever allocates
+				static const std::overflow_error retr("Integer value out of range");
 				
-				return a+b;
+				return retr;
 			
 			}
 			
 			
-			static T Subtract (T a, T b) {
+			static const char * get_name (Operation op) noexcept {
 			
-				//	The only way subtraction can overflow
-				//	is if what we're subtracting is larger than
-				//	what is being subtracted from
-				if (b>a) Raise();
+				switch (op) {
 				
-				return a-b;
+					case Operation::Add:
+						return "add";
+					case Operation::Subtract:
+						return "subtract";
+					case Operation::Multiply:
+						return "multiply";
+					case Operation::Divide:
+						return "divide";
+					case Operation::Modulus:
+						return "modulus";
+					case Operation::Negate:
+						return "negate";
+					case Operation::Abs:
+						return "abs";
+					case Operation::Expression:
+						return "expression";
+					case Operation::MultiplyAdd:
+						return "multiply-add";
+					case Operation::MultiplySubtract:
+						return "multiply-subtract";
+					case Operation::Sum:
+						return "sum";
+					case Operation::Product:
+						return "product";
+					case Operation::MultiplyDivide:
+						return "multiply-divide";
+					case Operation::Power:
+						return "power";
+					case Operation::SquareRoot:
+						return "square root";
+					case Operation::Logarithm:
+						return "logarithm";
+					case Operation::BitCount:
+						return "bit count";
+					case Operation::ShiftLeft:
+						return "shift left";
+					case Operation::ShiftRight:
+						return "shift right";
+					case Operation::Range:
+						return "range";
+					case Operation::Midpoint:
+						return "midpoint";
+					case Operation::Difference:
+						return "difference";
+					case Operation::Align:
+						return "align";
+					case Operation::RoundToMultiple:
+						return "round to multiple";
+					default:
+						break;
+				
+				}
+				
+				return "cast";
 			
 			}
 			
 			
-			static T Multiply (T a, T b) {
+			static int format (char * buffer, std::size_t size, Operand o) noexcept {
 			
-				//	If either value is zero, the result is
-				//	zero at once
-				if ((a==0) || (b==0)) return 0;
-				//	If either value is one, just return
-				//	the other value
-				if (a==1) return b;
-				if (b==1) return a;
+				if (!o.Signed()) return std::snprintf(buffer,size,"%ju",o.Get());
 				
-				//	Dividing the maximum value by a gives
-				//	the number of times by which a must be
-				//	multiplied to give the maximum value.
-				//
-				//	If this is less than b, then multiplication
-				//	by b will result in a number much more
-				//	than the maximum (i.e. an overflow).
-				if ((max/a)<b) Raise();
+				//	Sign extend from the width of the operand
+				auto bits=o.Get();
+				if ((o.Width()<static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits)) && ((bits>>(o.Width()-1))!=0)) {
 				
-				return a*b;
+					bits|=~((static_cast<std::uintmax_t>(1)<<o.Width())-1);
+				
+				}
+				
+				return std::snprintf(buffer,size,"%jd",static_cast<std::intmax_t>(bits));
 			
 			}
 			
 			
-			static T Divide (T a, T b) {
+			bool describe () const noexcept {
 			
-				division_check(a,b);
+				auto base=std::overflow_error::what();
 				
-				return a/b;
+				char a [24];
+				char b [24];
+				char c [24];
+				if ((format(a,sizeof(a),operands[0])<0) || (format(b,sizeof(b),operands[1])<0) || (format(c,sizeof(c),operands[2])<0)) return false;
+				
+				auto sign=is_signed ? "signed" : "unsigned";
+				if (((count==1) ? std::snprintf(
+					buffer,
+					sizeof(buffer),
+					"%s (%s of %s in %zu bit %s)",
+					base,
+					get_name(op),
+					a,
+					width,
+					sign
+				) : ((count==2) ? std::snprintf(
+					buffer,
+					sizeof(buffer),
+					"%s (%s of %s and %s in %zu bit %s)",
+					base,
+					get_name(op),
+					a,
+					b,
+					width,
+					sign
+				) : std::snprintf(
+					buffer,
+					sizeof(buffer),
+					"%s (%s of %s, %s, and %s in %zu bit %s)",
+					base,
+					get_name(op),
+					a,
+					b,
+					c,
+					width,
+					sign
+				)))<0) return false;
+				
+				return true;
 			
 			}
 			
 			
-			constexpr static T Abs (T i) noexcept {
+			//	The message is only formatted when it's asked for,
+			//	so that throwing (and invoking callbacks) merely
+			//	copies the operands
+			enum : unsigned char {
 			
-				//	Unsigned numbers already represent their
-				//	own absolute value, since they cannot be
-				//	negative
-				return i;
+				unformatted,
+				formatting,
+				formatted,
+				failed
 			
-			}
+			};
 			
 			
-			static T Modulus (T a, T b) {
+			Operation op;
+			std::size_t width;
+			bool is_signed;
+			Operand operands [3];
+			std::size_t count;
+			mutable char buffer [128];
+			mutable std::atomic<unsigned char> state;
+		
+		
+		public:
+		
+		
+			/**
+			 *	Creates a new overflow error.
+			 *
+			 *	\param [in] op
+			 *		The operation which went out of range.
+			 *	\param [in] width
+			 *		The width in bits of the integer type the
+			 *		result was to be represented by.
+			 *	\param [in] is_signed
+			 *		Whether the integer type the result was to
+			 *		be represented by is signed.
+			 *	\param [in] a
+			 *		The operand.
+			 */
+			OverflowError (Operation op, std::size_t width, bool is_signed, Operand a) noexcept
+				:	std::overflow_error(message()),
+					op(op),
+					width(width),
+					is_signed(is_signed),
+					operands{a,Operand(),Operand()},
+					count(1),
+					state(unformatted)
+			{	}
+			/**
+			 *	Creates a new overflow error.
+			 *
+			 *	\param [in] op
+			 *		The operation which went out of range.
+			 *	\param [in] width
+			 *		The width in bits of the integer type the
+			 *		result was to be represented by.
+			 *	\param [in] is_signed
+			 *		Whether the integer type the result was to
+			 *		be represented by is signed.
+			 *	\param [in] a
+			 *		The left hand operand.
+			 *	\param [in] b
+			 *		The right hand operand.
+			 */
+			OverflowError (Operation op, std::size_t width, bool is_signed, Operand a, Operand b) noexcept
+				:	std::overflow_error(message()),
+					op(op),
+					width(width),
+					is_signed(is_signed),
+					operands{a,b,Operand()},
+					count(2),
+					state(unformatted)
+			{	}
+			/**
+			 *	Creates a new overflow error.
+			 *
+			 *	\param [in] op
+			 *		The operation which went out of range.
+			 *	\param [in] width
+			 *		The width in bits of the integer type the
+			 *		result was to be represented by.
+			 *	\param [in] is_signed
+			 *		Whether the integer type the result was to
+			 *		be represented by is signed.
+			 *	\param [in] a
+			 *		The first operand.
+			 *	\param [in] b
+			 *		The second operand.
+			 *	\param [in] c
+			 *		The third operand.
+			 */
+			OverflowError (Operation op, std::size_t width, bool is_signed, Operand a, Operand b, Operand c) noexcept
+				:	std::overflow_error(message()),
+					op(op),
+					width(width),
+					is_signed(is_signed),
+					operands{a,b,c},
+					count(3),
+					state(unformatted)
+			{	}
+			/**
+			 *	Creates a copy of an overflow error.
+			 *
+			 *	\param [in] other
+			 *		The overflow error to copy.
+			 */
+			OverflowError (const OverflowError & other) noexcept
+				:	std::overflow_error(other),
+					op(other.op),
+					width(other.width),
+					is_signed(other.is_signed),
+					operands{other.operands[0],other.operands[1],other.operands[2]},
+					count(other.count),
+					state(unformatted)
+			{	}
 			
-				division_check(a,b);
 			
-				return a%b;
+			/**
+			 *	Replaces this overflow error with a copy of
+			 *	another.
+			 *
+			 *	\param [in] other
+			 *		The overflow error to copy.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			OverflowError & operator = (const OverflowError & other) noexcept {
+			
+				std::overflow_error::operator=(other);
+				op=other.op;
+				width=other.width;
+				is_signed=other.is_signed;
+				for (std::size_t i=0;i<3;++i) operands[i]=other.operands[i];
+				count=other.count;
+				state.store(unformatted,std::memory_order_relaxed);
+				
+				return *this;
 			
 			}
-	
-	
-	};
-	
-	
-	template <typename T>
-	class Arithmetic<T,typename std::enable_if<std::is_signed<T>::value>::type> {
-	
-	
-		private:
-		
-		
-			static constexpr T min=std::numeric_limits<T>::min();
-			static constexpr T max=std::numeric_limits<T>::max();
 			
 			
-			enum class Sign {
+			/**
+			 *	Retrieves the operation which went out of range.
+			 *
+			 *	\return
+			 *		The operation.
+			 */
+			Operation GetOperation () const noexcept {
 			
-				Negative,
-				Positive,
-				Neither
+				return op;
 			
-			};
+			}
 			
 			
-			constexpr static Sign get_sign (T i) noexcept {
+			/**
+			 *	Retrieves the width of the integer type the result
+			 *	of the operation was to be represented by.
+			 *
+			 *	\return
+			 *		The width in bits.
+			 */
+			std::size_t Width () const noexcept {
 			
-				return (i<0) ? Sign::Negative : ((i>0) ? Sign::Positive : Sign::Neither);
+				return width;
 			
 			}
 			
 			
-			static std::pair<Sign,Sign> get_signs (T a, T b) noexcept {
+			/**
+			 *	Determines whether the integer type the result of
+			 *	the operation was to be represented by is signed.
+			 *
+			 *	\return
+			 *		\em true if the type is signed, \em false
+			 *		otherwise.
+			 */
+			bool Signed () const noexcept {
 			
-				return std::pair<Sign,Sign>(get_sign(a),get_sign(b));
+				return is_signed;
 			
 			}
 			
 			
-			static void division_check (T a, T b) {
+			/**
+			 *	Retrieves the number of operands of the operation.
+			 *
+			 *	\return
+			 *		The number of operands.
+			 */
+			std::size_t OperandCount () const noexcept {
 			
-				if (
-					//	Catch divide by zero
-					(b==0) ||
-					//	Dividing by negative one changes the sign of
-					//	the first operand, which can cause an overflow
-					//	if the smallest integer is the other operand
-					//	(since the positive and negative spaces of
-					//	two's complement numbers are asymmetric)
-					((b==-1) && (a==min))
-				) Raise();
+				return count;
 			
 			}
 			
 			
-		public:
-		
-		
-			static T Add (T a, T b) {
+			/**
+			 *	Retrieves an operand of the operation.
+			 *
+			 *	\param [in] i
+			 *		The index of the operand, which must be less
+			 *		than OperandCount.
+			 *
+			 *	\return
+			 *		The operand.
+			 */
+			Operand GetOperand (std::size_t i) const noexcept {
 			
-				//	If either operand is zero, addition cannot
-				//	overflow
-				if (a==0) return b;
-				if (b==0) return a;
-			
-				//	Get signs of operands
-				auto s=get_signs(a,b);
-				
-				//	If the signs are opposite, addition cannot
-				//	overflow
-				if (s.first!=s.second) return a+b;
-				
-				//	If both signs are positive, and a is less than
-				//	b away from the maximum, then adding a to b will
-				//	more than cross the gap between a and the maximum
-				//	(i.e. the addition will overflow)
-				if (s.first==Sign::Positive) {
-				
-					if ((max-a)<b) Raise();
-				
-				//	If both signs are negative, and subtracting a from
-				//	the minimum (i.e. increasing the minimum by the
-				//	absolute value of a) causes the minimum to exceed
-				//	b, then adding b to a will cause a's value to decrease
-				//	such that it goes beneath the minimum (i.e. the
-				//	addition will overflow)
-				} else if ((min-a)>b) {
-				
-					Raise();
-					
-				}
-				
-				return a+b;
+				return operands[i];
 			
 			}
 			
 			
-			static T Subtract (T a, T b) {
+			virtual const char * what () const noexcept override {
 			
-				//	If the second operand is zero, subtraction
-				//	cannot overflow
-				if (b==0) return a;
+				auto s=state.load(std::memory_order_acquire);
+				if (s==unformatted) {
 				
-				//	Get signs of operands
-				auto s=get_signs(a,b);
-				
-				//	If the signs are the same, subtraction cannot overflow
-				if (s.first==s.second) return a-b;
-				
-				//	If the second sign is negative, a-b is really
-				//	equivalent to a+-b, so we use a test from the
-				//	Add method
-				if (s.second==Sign::Negative) {
-				
-					if ((max+b)<a) Raise();
-				
-				//	Otherwise the first sign is negative, which means
-				//	that the second sign is positive, which means that
-				//	a-b is really -b+a, so we use another check from
-				//	the Add method
-				//
-				//	Since we know that the second sign is positive, we
-				//	can use -b safely, due to the fact that all positive
-				//	integers have a corresponding negative integer under
-				//	two's complement
-				} else if ((min-a)>-b) {
-				
-					Raise();
+					//	Only one thread formats the message, others
+					//	get the plain message until it's done
+					if (state.compare_exchange_strong(s,formatting,std::memory_order_acquire)) {
+					
+						s=describe() ? formatted : failed;
+						state.store(s,std::memory_order_release);
+					
+					}
 				
 				}
 				
-				return a-b;
-			
-			}
-			
-			
-			static T Abs (T i) {
-			
-				//	If the integer is zero or positive, we already
-				//	have the absolute value
-				if (i>=0) return i;
-				
-				//	Due to the unequal positive/negative range of
-				//	two's complement numbers, the minimum value does
-				//	not have a corresponding positive value, so this
-				//	is the overflow condition
-				if (i==min) Raise();
-				
-				//	Otherwise the value is negative and has a corresponding
-				//	positive value, so we multiply it by -1 and return
-				return -i;
-			
-			}
-			
-			
-			static T Multiply (T a, T b) {
-			
-				//	If either value is zero, the result is
-				//	zero at once
-				if ((a==0) || (b==0)) return 0;
-				//	If either value is one, just return
-				//	the other value
-				if (a==1) return b;
-				if (b==1) return a;
-				
-				//	Perform identical check to the one used for
-				//	unsigned, only using magnitudes to handle
-				//	negative numbers
-				if ((max/Abs(a))<Abs(b)) Raise();
-				
-				return a*b;
-			
-			}
-			
-			
-			static T Divide (T a, T b) {
-			
-				division_check(a,b);
-				
-				return a/b;
-			
-			}
-			
-			
-			static T Modulus (T a, T b) {
-			
-				division_check(a,b);
-				
-				return a%b;
+				return (s==formatted) ? buffer : std::overflow_error::what();
 			
 			}
 	
@@ -437,363 +600,8790 @@ namespace Safe {
 	};
 	
 	
-	template <typename A, typename B>
-	constexpr typename std::enable_if<std::is_signed<A>::value==std::is_signed<B>::value,bool>::type IsEqual (A a, B b) noexcept {
+	/**
+	 *	\cond
+	 */
+
+
+	//	Raising is the exceptional case, so it's kept out of
+	//	line and out of the way of the code which calls it
+	template <typename T, typename... Operands>
+	[[noreturn]]
+	SAFE_COLD void Raise (Operation op, Operands... operands) {
 	
-		return a==b;
+		throw OverflowError(op,std::numeric_limits<T>::digits+(std::is_signed<T>::value ? 1 : 0),std::is_signed<T>::value,operands...);
 	
 	}
 	
 	
-	template <typename A, typename B>
-	constexpr typename std::enable_if<std::is_signed<A>::value!=std::is_signed<B>::value,bool>::type IsEqual (A a, B b) noexcept {
+	/**
+	 *	\endcond
+	 */
 	
-		return (IsNegative(a) || IsNegative(b)) ? false : (static_cast<typename std::make_unsigned<A>::type>(a)==static_cast<typename std::make_unsigned<B>::type>(b));
 	
-	}
+	/**
+	 *	Describes which way an operation went out of range.
+	 */
+	enum class Direction {
 	
+		Above,
+		Below,
+		Undefined
 	
-	template <typename A, typename B>
-	constexpr typename std::enable_if<std::is_signed<A>::value==std::is_signed<B>::value,int>::type Compare (A a, B b) noexcept {
+	};
 	
-		return (a>b) ? 1 : ((a==b) ? 0 : -1);
 	
-	}
+	/**
+	 *	An overflow policy which throws a Safe::OverflowError
+	 *	when an integer value goes out of range.
+	 *
+	 *	This is the default policy.
+	 *
+	 *	An overflow policy is a class with a static member
+	 *	function template \em Overflow, which is invoked with
+	 *	the result of the operation wrapped modulo 2^N, the
+	 *	Direction in which the result went out of range, the
+	 *	Operation, and its operands, and which returns the
+	 *	value the operation shall yield.
+	 */
+	class Throw {
 	
 	
-	template <typename A, typename B>
-	constexpr typename std::enable_if<std::is_signed<A>::value!=std::is_signed<B>::value,int>::type Compare (A a, B b) noexcept {
+		public:
+		
+		
+			template <typename T, typename... Operands>
+			[[noreturn]]
+			static T Overflow (T, Direction, Operation op, Operands... operands) {
+			
+				Raise<T>(op,operands...);
+			
+			}
 	
-		return IsNegative(a) ? -1 : (IsNegative(b) ? 1 : Compare(
-			static_cast<typename std::make_unsigned<A>::type>(a),
-			static_cast<typename std::make_unsigned<B>::type>(b)
-		));
 	
-	}
-
+	};
 	
-	/**
-	 *	\endcond
-	 */
-	 
 	
 	/**
-	 *	Safely casts from one integer type to another.
-	 *
-	 *	This overload activates when \em B can represent
-	 *	every value of \em A, is a compile time constant
-	 *	expression, and as such does not throw.
-	 *
-	 *	\tparam B
-	 *		The type of integer to cast to.
-	 *	\tparam A
-	 *		The type of integer to cast from.
-	 *
-	 *	\param [in] from
-	 *		An integer of type \em A.
+	 *	An overflow policy which yields the largest value when
+	 *	an integer value goes above its range, and the smallest
+	 *	value when it goes below its range.
 	 *
-	 *	\return
-	 *		\em from represented as type \em B.
+	 *	Results which are undefined (i.e. the remainder of
+	 *	division by zero) are zero.
 	 */
-	template <typename B, typename A>
-	constexpr typename std::enable_if<NoThrowConvertible<B,A>::value,B>::type Cast (A from) noexcept {
+	class Saturate {
 	
-		return static_cast<B>(from);
 	
-	}
+		public:
+		
+		
+			template <typename T, typename... Operands>
+			static constexpr T Overflow (T wrapped, Direction d, Operation, Operands...) noexcept {
+			
+				return (d==Direction::Above) ? std::numeric_limits<T>::max() : ((d==Direction::Below) ? std::numeric_limits<T>::min() : wrapped);
+			
+			}
+	
+	
+	};
 	
 	
 	/**
-	 *	Safely casts from one integer type to another.
-	 *
-	 *	This overload activates when \em B cannot represent
-	 *	every value of \em A, and as such may throw when
-	 *	\em from is out of range of \em B.
-	 *
-	 *	\tparam B
-	 *		The type of integer to cast to.
-	 *	\tparam A
-	 *		The type of integer to cast from.
-	 *
-	 *	\param [in] from
-	 *		An integer of type \em A.
+	 *	An overflow policy which yields results wrapped modulo
+	 *	2^N, as built in unsigned arithmetic does.
 	 *
-	 *	\return
-	 *		\em from represented as type \em B.
+	 *	Results which are undefined (i.e. division by zero)
+	 *	are zero.
 	 */
-	template <typename B, typename A>
-	typename std::enable_if<!NoThrowConvertible<B,A>::value,B>::type Cast (A from) {
+	class Wrap {
+	
 	
-		if (!InRange<B>(from)) Raise();
+		public:
 		
-		return static_cast<B>(from);
+		
+			template <typename T, typename... Operands>
+			static constexpr T Overflow (T wrapped, Direction, Operation, Operands...) noexcept {
+			
+				return wrapped;
+			
+			}
+	
+	
+	};
 	
-	}
 	
-
 	/**
-	 *	An integer which may be converted, assigned to,
-	 *	and constructed safely, in addition to providing
-	 *	checked arithmetic.
-	 *
-	 *	\tparam IntegerType
-	 *		The type of integer to wrap.
+	 *	An overflow policy which terminates the program
+	 *	immediately when an integer value goes out of range.
 	 */
-	template <typename IntegerType>
-	class Integer {
+	class Trap {
 	
 	
-		private:
+		public:
 		
 		
-			IntegerType i;
-			
-			
-			typedef std::numeric_limits<IntegerType> limits;
-			static constexpr IntegerType min=limits::min();
-			static constexpr IntegerType max=limits::max();
+			template <typename T, typename... Operands>
+			[[noreturn]]
+			static T Overflow (T, Direction, Operation, Operands...) noexcept {
 			
+				SAFE_TRAP();
 			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	An overflow policy which invokes a function when an
+	 *	integer value goes out of range, and then yields the
+	 *	result another overflow policy would.
+	 *
+	 *	\tparam Handler
+	 *		The function to invoke, which is passed a
+	 *		Safe::OverflowError describing the operation.
+	 *	\tparam Fallback
+	 *		The overflow policy which determines the result.
+	 *		Defaults to Safe::Saturate.
+	 */
+	template <void (* Handler) (const OverflowError &), typename Fallback=Saturate>
+	class Callback {
+	
+	
 		public:
 		
 		
-			/**
-			 *	The type of integer this safe integer wraps.
-			 */
-			typedef IntegerType Type;
-			/**
-			 *	The type of integer this safe integer wraps, converted
-			 *	to signed.
-			 */
-			typedef typename std::make_signed<IntegerType>::type SignedType;
-			/**
-			 *	The type of integer this safe integer wraps, converted
-			 *	to unsigned.
-			 */
-			typedef typename std::make_unsigned<IntegerType>::type UnsignedType;
-			
-			
-			/**
-			 *	\em true if \em IntegerType is signed, \em false
-			 *	otherwise.
-			 */
-			static constexpr bool Signed=std::is_signed<IntegerType>::value;
-			/**
-			 *	\em true if \em IntegerType is unsigned, \em false
-			 *	otherwise.
-			 */
-			static constexpr bool Unsigned=std::is_unsigned<IntegerType>::value;
+			template <typename T, typename... Operands>
+			static T Overflow (T wrapped, Direction d, Operation op, Operands... operands) {
 			
+				Handler(OverflowError(op,std::numeric_limits<T>::digits+(std::is_signed<T>::value ? 1 : 0),std::is_signed<T>::value,operands...));
+				
+				return Fallback::Overflow(wrapped,d,op,operands...);
 			
-			Integer (const Integer &) = default;
-			Integer (Integer &&) = default;
-			Integer & operator = (const Integer &) = default;
-			Integer & operator = (Integer &&) = default;
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	An overflow policy which, when it's the policy of the
+	 *	left hand side, causes addition, subtraction, and
+	 *	multiplication of safe integers to yield a safe integer
+	 *	of a type wide enough to represent every possible
+	 *	result, so that those operations are never checked.
+	 *
+	 *	Everything else (i.e. conversions, division, and
+	 *	operations for which there's no wide enough type)
+	 *	is checked, and the result is determined by another
+	 *	overflow policy.
+	 *
+	 *	\tparam Fallback
+	 *		The overflow policy which determines what
+	 *		happens when an operation goes out of range.
+	 *		Defaults to Safe::Throw.
+	 */
+	template <typename Fallback=Throw>
+	class Promote {
+	
+	
+		public:
 		
 		
-			/**
-			 *	Creates a safe integer by wrapping an integer.
-			 *
-			 *	\param [in] i
-			 *		The integer to wrap.  Defaults to zero.
-			 */
-			constexpr Integer (IntegerType i=0) noexcept : i(i) {	}
-			/**
-			 *	Creates a safe integer by wrapping an integer of
-			 *	another type.
-			 *
-			 *	\tparam T
-			 *		The type of integer to wrap.
-			 *
-			 *	\param [in] i
-			 *		The integer.
-			 */
-			template <typename T>
-			Integer (T i) noexcept(noexcept(Cast<IntegerType>(i))) : i(Cast<IntegerType>(i)) {	}
-			/**
-			 *	Creates a safe integer from another safe integer.
-			 *
-			 *	\tparam T
-			 *		The type of integer the other safe integer wraps.
-			 *
-			 *	\param [in] i
-			 *		The other safe integer.
-			 */
-			template <typename T>
-			Integer (Integer<T> i) noexcept(noexcept(Cast<IntegerType>(std::declval<T>()))) : i(Cast<IntegerType>(static_cast<T>(i))) {	}
+			template <typename T, typename... Operands>
+			static constexpr T Overflow (T wrapped, Direction d, Operation op, Operands... operands) noexcept(noexcept(Fallback::Overflow(wrapped,d,op,operands...))) {
 			
+				return Fallback::Overflow(wrapped,d,op,operands...);
 			
-			/**
-			 *	Assigns an integer to this safe integer.
-			 *
-			 *	\param [in] i
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	//	Determines whether the right hand side of mixed type
+	//	arithmetic is converted to the type of the left hand
+	//	side before the operation, which is the case for
+	//	policies which never yield a value, or whether the
+	//	operation is computed exactly and the policy is applied
+	//	only to its result
+	template <typename Policy>
+	class ConvertsFirst : public std::false_type {	};
+	
+	
+	template <>
+	class ConvertsFirst<Throw> : public std::true_type {	};
+	
+	
+	template <>
+	class ConvertsFirst<Trap> : public std::true_type {	};
+	
+	
+	template <void (* Handler) (const OverflowError &), typename Fallback>
+	class ConvertsFirst<Callback<Handler,Fallback>> : public ConvertsFirst<Fallback> {	};
+	
+	
+	template <typename Fallback>
+	class ConvertsFirst<Promote<Fallback>> : public ConvertsFirst<Fallback> {	};
+	
+	
+	template <typename B, typename A, typename=void>
+	class NoThrowConvertible : public std::false_type {	};
+	
+	
+	template <typename B, typename A>
+	class NoThrowConvertible<
+		B,
+		A,
+		typename std::enable_if<
+			((std::is_signed<A>::value==std::is_signed<B>::value) && (sizeof(B)>=sizeof(A))) ||
+			(std::is_unsigned<A>::value && std::is_signed<B>::value && (sizeof(B)>sizeof(A)))
+		>::type
+	> : public std::true_type {	};
+	
+	
+	//	-	A signed, B signed, B>=A
+	//	-	A unsigned, B unsigned, B>=A
+	//	-	A unsigned, B signed, B>A
+	//
+	//	Unconditionally true
+	template <typename B, typename A>
+	constexpr typename std::enable_if<
+		NoThrowConvertible<B,A>::value,
+		bool
+	>::type InRange (A) noexcept {
+	
+		return true;
+	
+	}
+	
+	
+	//	-	A signed, B signed, B<A
+	//
+	//	Checks min and max of B to ensure integer is
+	//	bounded by both
+	template <typename B, typename A>
+	constexpr typename std::enable_if<
+		std::is_signed<A>::value && std::is_signed<B>::value && (sizeof(B)<sizeof(A)),
+		bool
+	>::type InRange (A i) noexcept {
+	
+		return (i<=static_cast<A>(std::numeric_limits<B>::max())) && (i>=static_cast<A>(std::numeric_limits<B>::min()));
+	
+	}
+	
+	
+	//	-	A unsigned, B unsigned, B<A
+	//
+	//	Checks max of B to ensure integer is bounded
+	template <typename B, typename A>
+	constexpr typename std::enable_if<
+		std::is_unsigned<A>::value && std::is_unsigned<B>::value && (sizeof(B)<sizeof(A)),
+		bool
+	>::type InRange (A i) noexcept {
+	
+		return i<=static_cast<A>(std::numeric_limits<B>::max());
+	
+	}
+	
+	
+	//	-	A signed, B unsigned
+	//
+	//	False when integer is negative, otherwise passes through to:
+	//
+	//	-	A unsigned, B unsigned
+	template <typename B, typename A>
+	constexpr typename std::enable_if<
+		std::is_signed<A>::value && std::is_unsigned<B>::value,
+		bool
+	>::type InRange (A i) noexcept {
+	
+		return (i<0) ? false : InRange<B>(static_cast<typename std::make_unsigned<A>::type>(i));
+	
+	}
+	
+	
+	//	-	A unsigned, B signed, B<=A
+	//
+	//	True if integer is less than max of B
+	template <typename B, typename A>
+	constexpr typename std::enable_if<
+		std::is_unsigned<A>::value && std::is_signed<B>::value && (sizeof(B)<=sizeof(A)),
+		bool
+	>::type InRange (A i) noexcept {
+	
+		return i<=static_cast<A>(std::numeric_limits<B>::max());
+	
+	}
+	
+	
+	template <typename T>
+	constexpr typename std::enable_if<std::is_unsigned<T>::value,bool>::type IsNegative (T) noexcept {
+	
+		return false;
+	
+	}
+	
+	
+	template <typename T>
+	constexpr typename std::enable_if<std::is_signed<T>::value,bool>::type IsNegative (T i) noexcept {
+	
+		return i<0;
+	
+	}
+	
+	
+	#ifdef SAFE_INT128
+	__extension__ typedef __int128 Int128;
+	__extension__ typedef unsigned __int128 UInt128;
+	#endif
+	
+	
+	template <typename T>
+	class Found {
+	
+	
+		public:
+		
+		
+			typedef T Type;
+			static constexpr bool Exists=true;
+	
+	
+	};
+	
+	
+	//	Finds the first type in Ts which is at least Width
+	//	bytes wide
+	template <std::size_t Width, typename... Ts>
+	class SelectWidth {
+	
+	
+		public:
+		
+		
+			static constexpr bool Exists=false;
+	
+	
+	};
+	
+	
+	template <std::size_t Width, typename T, typename... Ts>
+	class SelectWidth<Width,T,Ts...> : public std::conditional<
+		sizeof(T)>=Width,
+		Found<T>,
+		SelectWidth<Width,Ts...>
+	>::type {	};
+	
+	
+	//	Finds an integer type of the same signedness as T
+	//	which is at least Width bytes wide, if there is one
+	template <typename T, std::size_t Width>
+	class AtLeast : public std::conditional<
+		std::is_signed<T>::value,
+		SelectWidth<
+			Width,
+			signed char,
+			short,
+			int,
+			long,
+			long long
+			#ifdef SAFE_INT128
+			,Int128
+			#endif
+		>,
+		SelectWidth<
+			Width,
+			unsigned char,
+			unsigned short,
+			unsigned int,
+			unsigned long,
+			unsigned long long
+			#ifdef SAFE_INT128
+			,UInt128
+			#endif
+		>
+	>::type {	};
+	
+	
+	//	Finds an integer type of the same signedness as T
+	//	which is at least twice as wide as T, if there is
+	//	one
+	template <typename T>
+	class Wider : public AtLeast<T,sizeof(T)*2> {	};
+	
+	
+	//	Adds a and b and stores the result in r, returning
+	//	true if the result could not be represented by T (in
+	//	which case r holds the result wrapped modulo 2^N)
+	#ifdef SAFE_BUILTINS
+	template <typename T>
+	SAFE_CONSTEXPR14 bool AddOverflows (T a, T b, T & r) noexcept {
+	
+		return __builtin_add_overflow(a,b,&r);
+	
+	}
+	#else
+	//	The addition is performed in unsigned arithmetic, which
+	//	wraps rather than invoking undefined behaviour
+	template <typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_unsigned<T>::value,bool>::type AddOverflows (T a, T b, T & r) noexcept {
+	
+		r=static_cast<T>(a+b);
+		
+		//	If the sum wrapped it's necessarily smaller than
+		//	both operands
+		return r<a;
+	
+	}
+	
+	
+	template <typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_signed<T>::value,bool>::type AddOverflows (T a, T b, T & r) noexcept {
+	
+		typedef typename std::make_unsigned<T>::type type;
+		
+		r=static_cast<T>(static_cast<type>(static_cast<type>(a)+static_cast<type>(b)));
+		
+		//	Addition can only overflow when both operands have
+		//	the same sign, and it has overflowed if and only if
+		//	the sign of the result is different from the sign
+		//	of both operands
+		return ((a^r)&(b^r))<0;
+	
+	}
+	#endif
+	
+	
+	//	Subtracts b from a and stores the result in r,
+	//	returning true if the result could not be represented
+	//	by T (in which case r holds the result wrapped modulo
+	//	2^N)
+	#ifdef SAFE_BUILTINS
+	template <typename T>
+	SAFE_CONSTEXPR14 bool SubtractOverflows (T a, T b, T & r) noexcept {
+	
+		return __builtin_sub_overflow(a,b,&r);
+	
+	}
+	#else
+	template <typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_unsigned<T>::value,bool>::type SubtractOverflows (T a, T b, T & r) noexcept {
+	
+		r=static_cast<T>(a-b);
+		
+		//	The only way subtraction can overflow is if what
+		//	we're subtracting is larger than what is being
+		//	subtracted from
+		return b>a;
+	
+	}
+	
+	
+	template <typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_signed<T>::value,bool>::type SubtractOverflows (T a, T b, T & r) noexcept {
+	
+		typedef typename std::make_unsigned<T>::type type;
+		
+		r=static_cast<T>(static_cast<type>(static_cast<type>(a)-static_cast<type>(b)));
+		
+		//	Subtraction can only overflow when the operands have
+		//	different signs, and it has overflowed if and only if
+		//	the sign of the result is different from the sign of
+		//	the first operand
+		return ((a^b)&(a^r))<0;
+	
+	}
+	#endif
+	
+	
+	//	Multiplies a and b and stores the result in r,
+	//	returning true if the result could not be represented
+	//	by T (in which case r holds the result wrapped modulo
+	//	2^N)
+	#ifdef SAFE_BUILTINS
+	template <typename T>
+	SAFE_CONSTEXPR14 bool MultiplyOverflows (T a, T b, T & r) noexcept {
+	
+		return __builtin_mul_overflow(a,b,&r);
+	
+	}
+	#else
+	//	When there's an integer type twice as wide as T the
+	//	product cannot overflow in that type, so it's computed
+	//	exactly and then range checked
+	template <typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<Wider<T>::Exists,bool>::type MultiplyOverflows (T a, T b, T & r) noexcept {
+	
+		typedef typename Wider<T>::Type type;
+		
+		auto p=static_cast<type>(static_cast<type>(a)*static_cast<type>(b));
+		r=static_cast<T>(p);
+		
+		return (p>static_cast<type>(std::numeric_limits<T>::max())) || (std::is_signed<T>::value && (p<static_cast<type>(std::numeric_limits<T>::min())));
+	
+	}
+	
+	
+	//	Otherwise we fall back to division
+	template <typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<!Wider<T>::Exists && std::is_unsigned<T>::value,bool>::type MultiplyOverflows (T a, T b, T & r) noexcept {
+	
+		r=a*b;
+		
+		//	Dividing the maximum value by a gives the number
+		//	of times by which a must be multiplied to give the
+		//	maximum value.
+		//
+		//	If this is less than b, then multiplication by b
+		//	will result in a number much more than the maximum
+		//	(i.e. an overflow).
+		return (a!=0) && ((std::numeric_limits<T>::max()/a)<b);
+	
+	}
+	
+	
+	template <typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<!Wider<T>::Exists && std::is_signed<T>::value,bool>::type MultiplyOverflows (T a, T b, T & r) noexcept {
+	
+		typedef typename std::make_unsigned<T>::type type;
+		typedef std::numeric_limits<T> limits;
+		
+		r=static_cast<T>(static_cast<type>(a)*static_cast<type>(b));
+		
+		//	The same check as for unsigned, except that the
+		//	bound we divide depends on the sign of the result,
+		//	and dividing by a negative number reverses the
+		//	direction of the comparison
+		if (a>0) return (b>0) ? (a>(limits::max()/b)) : (b<(limits::min()/a));
+		if (b>0) return a<(limits::min()/b);
+		
+		return (a!=0) && (b<(limits::max()/a));
+	
+	}
+	#endif
+	
+	
+	//	Multiplies a and b and then adds c (or subtracts c if
+	//	Subtract is true), storing the result in r and returning
+	//	true if it could not be represented by T (in which case
+	//	r holds the result wrapped modulo 2^N, and d the direction
+	//	in which it went out of range)
+	//
+	//	When there's an integer type twice as wide as T neither
+	//	the product nor the sum can overflow in that type, so only
+	//	the final result is range checked
+	template <bool Subtract, typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<Wider<T>::Exists,bool>::type MultiplyAddOverflows (T a, T b, T c, T & r, Direction & d) noexcept {
+	
+		typedef typename Wider<T>::Type type;
+		
+		auto p=static_cast<type>(static_cast<type>(a)*static_cast<type>(b));
+		auto s=static_cast<type>(Subtract ? (p-static_cast<type>(c)) : (p+static_cast<type>(c)));
+		r=static_cast<T>(s);
+		
+		//	Unsigned subtraction wraps in the wider type as well,
+		//	so that has to be detected separately
+		bool below=(std::is_unsigned<T>::value && Subtract) ? (static_cast<type>(c)>p) : (s<static_cast<type>(std::numeric_limits<T>::min()));
+		bool above=!below && (s>static_cast<type>(std::numeric_limits<T>::max()));
+		d=below ? Direction::Below : Direction::Above;
+		
+		return below || above;
+	
+	}
+	
+	
+	//	Otherwise the checks on the product and the sum are
+	//	combined, which means that the product must also be
+	//	representable
+	template <bool Subtract, typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<!Wider<T>::Exists,bool>::type MultiplyAddOverflows (T a, T b, T c, T & r, Direction & d) noexcept {
+	
+		T p=0;
+		bool product=MultiplyOverflows(a,b,p);
+		bool sum=Subtract ? SubtractOverflows(p,c,r) : AddOverflows(p,c,r);
+		if (product) d=(IsNegative(a)!=IsNegative(b)) ? Direction::Below : Direction::Above;
+		else d=(IsNegative(c)!=Subtract) ? Direction::Below : Direction::Above;
+		
+		return product || sum;
+	
+	}
+	
+	
+	//	Determines whether a divided by b, or the remainder
+	//	thereof, cannot be computed
+	template <typename T>
+	constexpr typename std::enable_if<std::is_unsigned<T>::value,bool>::type DivideOverflows (T, T b) noexcept {
+	
+		//	Integer division always makes numbers smaller, since
+		//	there are no fractions
+		//
+		//	Therefore, the only dangerous condition is division
+		//	by zero
+		return b==0;
+	
+	}
+	
+	
+	template <typename T>
+	constexpr typename std::enable_if<std::is_signed<T>::value,bool>::type DivideOverflows (T a, T b) noexcept {
+	
+		return
+			//	Catch divide by zero
+			(b==0) ||
+			//	Dividing by negative one changes the sign of
+			//	the first operand, which can cause an overflow
+			//	if the smallest integer is the other operand
+			//	(since the positive and negative spaces of
+			//	two's complement numbers are asymmetric)
+			((b==-1) && (a==std::numeric_limits<T>::min()));
+	
+	}
+	
+	
+	template <typename T, typename Policy=Throw, typename=void>
+	class Arithmetic {
+	
+	
+		private:
+		
+		
+			SAFE_CONSTEXPR14 static T division_overflow (Operation op, T a, T b) {
+			
+				//	Dividing by zero is the only way division may
+				//	overflow, the quotient of which goes above the
+				//	range unless the dividend is also zero
+				return Policy::Overflow(
+					T(0),
+					((op==Operation::Divide) && (a!=0)) ? Direction::Above : Direction::Undefined,
+					op,
+					a,
+					b
+				);
+			
+			}
+		
+		
+		public:
+		
+		
+			SAFE_CONSTEXPR14 static T Add (T a, T b) {
+			
+				T r=0;
+				if (SAFE_UNLIKELY(AddOverflows(a,b,r))) return Policy::Overflow(r,Direction::Above,Operation::Add,a,b);
+				
+				return r;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Subtract (T a, T b) {
+			
+				T r=0;
+				if (SAFE_UNLIKELY(SubtractOverflows(a,b,r))) return Policy::Overflow(r,Direction::Below,Operation::Subtract,a,b);
+				
+				return r;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Multiply (T a, T b) {
+			
+				T r=0;
+				if (SAFE_UNLIKELY(MultiplyOverflows(a,b,r))) return Policy::Overflow(r,Direction::Above,Operation::Multiply,a,b);
+				
+				return r;
+			
+			}
+			
+			
+			//	Incrementing and decrementing can only go out
+			//	of range at the limits, so that's all which
+			//	needs to be checked
+			SAFE_CONSTEXPR14 static T Increment (T i) {
+			
+				if (SAFE_UNLIKELY(i==std::numeric_limits<T>::max())) return Policy::Overflow(std::numeric_limits<T>::min(),Direction::Above,Operation::Add,i,T(1));
+				
+				return static_cast<T>(i+1);
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Decrement (T i) {
+			
+				if (SAFE_UNLIKELY(i==std::numeric_limits<T>::min())) return Policy::Overflow(std::numeric_limits<T>::max(),Direction::Below,Operation::Subtract,i,T(1));
+				
+				return static_cast<T>(i-1);
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Divide (T a, T b) {
+			
+				if (SAFE_UNLIKELY(DivideOverflows(a,b))) return division_overflow(Operation::Divide,a,b);
+				
+				return a/b;
+			
+			}
+			
+			
+			constexpr static T Abs (T i) noexcept {
+			
+				//	Unsigned numbers already represent their
+				//	own absolute value, since they cannot be
+				//	negative
+				return i;
+			
+			}
+			
+			
+			constexpr static T UnsignedAbs (T i) noexcept {
+			
+				return i;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Modulus (T a, T b) {
+			
+				if (SAFE_UNLIKELY(DivideOverflows(a,b))) return division_overflow(Operation::Modulus,a,b);
+			
+				return a%b;
+			
+			}
+	
+	
+	};
+	
+	
+	template <typename T, typename Policy>
+	class Arithmetic<T,Policy,typename std::enable_if<std::is_signed<T>::value>::type> {
+	
+	
+		private:
+		
+		
+			static constexpr T min=std::numeric_limits<T>::min();
+			
+			
+			SAFE_CONSTEXPR14 static T division_overflow (Operation op, T a, T b) {
+			
+				//	Dividing the smallest integer by negative one
+				//	wraps back around to the smallest integer, and
+				//	the remainder is zero
+				if (b!=0) return Policy::Overflow(
+					(op==Operation::Divide) ? min : T(0),
+					(op==Operation::Divide) ? Direction::Above : Direction::Undefined,
+					op,
+					a,
+					b
+				);
+				
+				//	The quotient of division by zero goes out of range
+				//	in the direction of the sign of the dividend
+				return Policy::Overflow(
+					T(0),
+					(op==Operation::Modulus) ? Direction::Undefined : ((a>0) ? Direction::Above : ((a<0) ? Direction::Below : Direction::Undefined)),
+					op,
+					a,
+					b
+				);
+			
+			}
+			
+			
+		public:
+		
+		
+			SAFE_CONSTEXPR14 static T Add (T a, T b) {
+			
+				T r=0;
+				//	Addition only overflows toward the sign of the
+				//	second operand
+				if (SAFE_UNLIKELY(AddOverflows(a,b,r))) return Policy::Overflow(r,(b<0) ? Direction::Below : Direction::Above,Operation::Add,a,b);
+				
+				return r;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Subtract (T a, T b) {
+			
+				T r=0;
+				//	Subtraction only overflows away from the sign of
+				//	the second operand
+				if (SAFE_UNLIKELY(SubtractOverflows(a,b,r))) return Policy::Overflow(r,(b<0) ? Direction::Above : Direction::Below,Operation::Subtract,a,b);
+				
+				return r;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Abs (T i) {
+			
+				//	If the integer is zero or positive, we already
+				//	have the absolute value
+				if (i>=0) return i;
+				
+				//	Due to the unequal positive/negative range of
+				//	two's complement numbers, the minimum value does
+				//	not have a corresponding positive value, so this
+				//	is the overflow condition
+				if (SAFE_UNLIKELY(i==min)) return Policy::Overflow(i,Direction::Above,Operation::Abs,i);
+				
+				//	Otherwise the value is negative and has a corresponding
+				//	positive value, so we multiply it by -1 and return
+				return -i;
+			
+			}
+			
+			
+			//	The magnitude of every signed value is representable
+			//	in the corresponding unsigned type, so this never
+			//	overflows
+			constexpr static typename std::make_unsigned<T>::type UnsignedAbs (T i) noexcept {
+			
+				typedef typename std::make_unsigned<T>::type type;
+				
+				return (i<0) ? static_cast<type>(type(0)-static_cast<type>(i)) : static_cast<type>(i);
+			
+			}
+			
+			
+			//	Only the minimum value lacks a negation, so there's
+			//	no need to go through multiplication
+			SAFE_CONSTEXPR14 static T Negate (T i) {
+			
+				if (SAFE_UNLIKELY(i==std::numeric_limits<T>::min())) return Policy::Overflow(i,Direction::Above,Operation::Negate,i);
+				
+				return -i;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Multiply (T a, T b) {
+			
+				T r=0;
+				//	The product is only negative when the signs of the
+				//	operands differ
+				if (SAFE_UNLIKELY(MultiplyOverflows(a,b,r))) return Policy::Overflow(r,((a<0)!=(b<0)) ? Direction::Below : Direction::Above,Operation::Multiply,a,b);
+				
+				return r;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Increment (T i) {
+			
+				if (SAFE_UNLIKELY(i==std::numeric_limits<T>::max())) return Policy::Overflow(std::numeric_limits<T>::min(),Direction::Above,Operation::Add,i,T(1));
+				
+				return static_cast<T>(i+1);
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Decrement (T i) {
+			
+				if (SAFE_UNLIKELY(i==std::numeric_limits<T>::min())) return Policy::Overflow(std::numeric_limits<T>::max(),Direction::Below,Operation::Subtract,i,T(1));
+				
+				return static_cast<T>(i-1);
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Divide (T a, T b) {
+			
+				if (SAFE_UNLIKELY(DivideOverflows(a,b))) return division_overflow(Operation::Divide,a,b);
+				
+				return a/b;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Modulus (T a, T b) {
+			
+				if (SAFE_UNLIKELY(DivideOverflows(a,b))) return division_overflow(Operation::Modulus,a,b);
+				
+				return a%b;
+			
+			}
+	
+	
+	};
+	
+	
+	template <typename A, typename B>
+	constexpr typename std::enable_if<std::is_signed<A>::value==std::is_signed<B>::value,bool>::type IsEqual (A a, B b) noexcept {
+	
+		return a==b;
+	
+	}
+	
+	
+	template <typename A, typename B>
+	constexpr typename std::enable_if<std::is_signed<A>::value!=std::is_signed<B>::value,bool>::type IsEqual (A a, B b) noexcept {
+	
+		return (IsNegative(a) || IsNegative(b)) ? false : (static_cast<typename std::make_unsigned<A>::type>(a)==static_cast<typename std::make_unsigned<B>::type>(b));
+	
+	}
+	
+	
+	template <typename A, typename B>
+	constexpr typename std::enable_if<std::is_signed<A>::value==std::is_signed<B>::value,int>::type Compare (A a, B b) noexcept {
+	
+		return (a>b) ? 1 : ((a==b) ? 0 : -1);
+	
+	}
+	
+	
+	template <typename A, typename B>
+	constexpr typename std::enable_if<std::is_signed<A>::value!=std::is_signed<B>::value,int>::type Compare (A a, B b) noexcept {
+	
+		return IsNegative(a) ? -1 : (IsNegative(b) ? 1 : Compare(
+			static_cast<typename std::make_unsigned<A>::type>(a),
+			static_cast<typename std::make_unsigned<B>::type>(b)
+		));
+	
+	}
+
+	
+	/**
+	 *	\endcond
+	 */
+	 
+	
+	/**
+	 *	Safely casts from one integer type to another.
+	 *
+	 *	This overload activates when \em B can represent
+	 *	every value of \em A, is a compile time constant
+	 *	expression, and as such does not throw.
+	 *
+	 *	\tparam B
+	 *		The type of integer to cast to.
+	 *	\tparam A
+	 *		The type of integer to cast from.
+	 *
+	 *	\param [in] from
+	 *		An integer of type \em A.
+	 *
+	 *	\return
+	 *		\em from represented as type \em B.
+	 */
+	template <typename B, typename A>
+	constexpr typename std::enable_if<NoThrowConvertible<B,A>::value,B>::type Cast (A from) noexcept {
+	
+		return static_cast<B>(from);
+	
+	}
+	
+	
+	/**
+	 *	Safely casts from one integer type to another.
+	 *
+	 *	This overload activates when \em B can represent
+	 *	every value of \em A, is a compile time constant
+	 *	expression, and as such does not throw.
+	 *
+	 *	\tparam B
+	 *		The type of integer to cast to.
+	 *	\tparam Policy
+	 *		The overflow policy.
+	 *	\tparam A
+	 *		The type of integer to cast from.
+	 *
+	 *	\param [in] from
+	 *		An integer of type \em A.
+	 *
+	 *	\return
+	 *		\em from represented as type \em B.
+	 */
+	template <typename B, typename Policy, typename A>
+	constexpr typename std::enable_if<
+		std::is_class<Policy>::value && NoThrowConvertible<B,A>::value,
+		B
+	>::type Cast (A from) noexcept {
+	
+		return static_cast<B>(from);
+	
+	}
+	
+	
+	/**
+	 *	Safely casts from one integer type to another.
+	 *
+	 *	This overload activates when \em B cannot represent
+	 *	every value of \em A, and as such invokes \em Policy
+	 *	when \em from is out of range of \em B.
+	 *
+	 *	\tparam B
+	 *		The type of integer to cast to.
+	 *	\tparam Policy
+	 *		The overflow policy.
+	 *	\tparam A
+	 *		The type of integer to cast from.
+	 *
+	 *	\param [in] from
+	 *		An integer of type \em A.
+	 *
+	 *	\return
+	 *		\em from represented as type \em B, or the result
+	 *		\em Policy yields if \em from is out of range.
+	 */
+	template <typename B, typename Policy, typename A>
+	SAFE_CONSTEXPR14 typename std::enable_if<
+		std::is_class<Policy>::value && !NoThrowConvertible<B,A>::value,
+		B
+	>::type Cast (A from) noexcept(noexcept(Policy::Overflow(std::declval<B>(),Direction::Above,Operation::Cast,from))) {
+	
+		if (SAFE_UNLIKELY(!InRange<B>(from))) return Policy::Overflow(
+			static_cast<B>(from),
+			IsNegative(from) ? Direction::Below : Direction::Above,
+			Operation::Cast,
+			from
+		);
+		
+		return static_cast<B>(from);
+	
+	}
+	
+	
+	/**
+	 *	Safely casts from one integer type to another.
+	 *
+	 *	This overload activates when \em B cannot represent
+	 *	every value of \em A, and as such may throw when
+	 *	\em from is out of range of \em B.
+	 *
+	 *	\tparam B
+	 *		The type of integer to cast to.
+	 *	\tparam A
+	 *		The type of integer to cast from.
+	 *
+	 *	\param [in] from
+	 *		An integer of type \em A.
+	 *
+	 *	\return
+	 *		\em from represented as type \em B.
+	 */
+	template <typename B, typename A>
+	SAFE_CONSTEXPR14 typename std::enable_if<!NoThrowConvertible<B,A>::value,B>::type Cast (A from) {
+	
+		return Cast<B,Throw>(from);
+	
+	}
+	
+	
+	/**
+	 *	An integer which may be converted, assigned to,
+	 *	and constructed safely, in addition to providing
+	 *	checked arithmetic.
+	 *
+	 *	\tparam IntegerType
+	 *		The type of integer to wrap.
+	 *	\tparam Policy
+	 *		The overflow policy, which determines what happens
+	 *		when an operation goes out of range.  Defaults to
+	 *		Safe::Throw.
+	 */
+	template <typename IntegerType, typename Policy=Throw>
+	class Integer {
+	
+	
+		private:
+		
+		
+			IntegerType i;
+			
+			
+			typedef std::numeric_limits<IntegerType> limits;
+			static constexpr IntegerType min=limits::min();
+			static constexpr IntegerType max=limits::max();
+			
+			
+		public:
+		
+		
+			/**
+			 *	The type of integer this safe integer wraps.
+			 */
+			typedef IntegerType Type;
+			/**
+			 *	The type of integer this safe integer wraps, converted
+			 *	to signed.
+			 */
+			typedef typename std::make_signed<IntegerType>::type SignedType;
+			/**
+			 *	The type of integer this safe integer wraps, converted
+			 *	to unsigned.
+			 */
+			typedef typename std::make_unsigned<IntegerType>::type UnsignedType;
+			/**
+			 *	The overflow policy of this safe integer.
+			 */
+			typedef Policy PolicyType;
+			
+			
+			/**
+			 *	\em true if \em IntegerType is signed, \em false
+			 *	otherwise.
+			 */
+			static constexpr bool Signed=std::is_signed<IntegerType>::value;
+			/**
+			 *	\em true if \em IntegerType is unsigned, \em false
+			 *	otherwise.
+			 */
+			static constexpr bool Unsigned=std::is_unsigned<IntegerType>::value;
+			
+			
+			Integer (const Integer &) = default;
+			Integer (Integer &&) = default;
+			Integer & operator = (const Integer &) = default;
+			Integer & operator = (Integer &&) = default;
+		
+		
+			/**
+			 *	Creates a safe integer by wrapping an integer.
+			 *
+			 *	\param [in] i
+			 *		The integer to wrap.  Defaults to zero.
+			 */
+			constexpr Integer (IntegerType i=0) noexcept : i(i) {	}
+			/**
+			 *	Creates a safe integer by wrapping an integer of
+			 *	another type.
+			 *
+			 *	\tparam T
+			 *		The type of integer to wrap.
+			 *
+			 *	\param [in] i
+			 *		The integer.
+			 */
+			template <typename T>
+			constexpr Integer (T i) noexcept(noexcept(Cast<IntegerType,Policy>(i))) : i(Cast<IntegerType,Policy>(i)) {	}
+			/**
+			 *	Creates a safe integer from another safe integer.
+			 *
+			 *	\tparam T
+			 *		The type of integer the other safe integer wraps.
+			 *	\tparam P
+			 *		The overflow policy of the other safe integer.
+			 *
+			 *	\param [in] i
+			 *		The other safe integer.
+			 */
+			template <typename T, typename P>
+			constexpr Integer (Integer<T,P> i) noexcept(noexcept(Cast<IntegerType,Policy>(std::declval<T>()))) : i(Cast<IntegerType,Policy>(i.Get())) {	}
+			
+			
+			/**
+			 *	Assigns an integer to this safe integer.
+			 *
+			 *	\param [in] i
+			 *		The integer.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			SAFE_CONSTEXPR14 Integer & operator = (IntegerType i) noexcept {
+			
+				this->i=std::move(i);
+				
+				return *this;
+			
+			}
+			
+			
+			/**
+			 *	Safely assigns an integer of another type to this
+			 *	safe integer.
+			 *
+			 *	\tparam T
+			 *		The type of the integer to assign.
+			 *
+			 *	\param [in] i
+			 *		The integer.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			template <typename T>
+			SAFE_CONSTEXPR14 Integer & operator = (T i) noexcept(noexcept(Cast<IntegerType,Policy>(i))) {
+			
+				this->i=Cast<IntegerType,Policy>(i);
+				
+				return *this;
+			
+			}
+			
+			
+			/**
+			 *	Safely assigns a safe integer of another type to this
+			 *	safe integer.
+			 *
+			 *	\tparam T
+			 *		The type of integer wrapped by the safe integer
+			 *		type which shall be assigned to this safe integer.
+			 *	\tparam P
+			 *		The overflow policy of the other safe integer.
+			 *
+			 *	\param [in] i
+			 *		The other safe integer.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			template <typename T, typename P>
+			SAFE_CONSTEXPR14 Integer & operator = (Integer<T,P> i) noexcept(noexcept(Cast<IntegerType,Policy>(std::declval<T>()))) {
+			
+				this->i=Cast<IntegerType,Policy>(i.Get());
+				
+				return *this;
+			
+			}
+			
+			
+			/**
+			 *	Retrieves the integer this safe integer represents.
+			 *
+			 *	\return
+			 *		The integer.
+			 */
+			constexpr operator IntegerType () const noexcept {
+			
+				return i;
+			
+			}
+			
+			
+			/**
+			 *	Retrieves the integer this safe integer represents
+			 *	safely converted to an integer of another type.
+			 *
+			 *	\tparam T
+			 *		The other type.
+			 *
+			 *	\return
+			 *		The integer.
+			 */
+			template <typename T>
+			SAFE_CONSTEXPR14 operator T () const noexcept(noexcept(Cast<T,Policy>(std::declval<IntegerType>()))) {
+			
+				return Cast<T,Policy>(i);
+			
+			}
+			
+			
+			/**
+			 *	Retrieves the integer this safe integer represents.
+			 *
+			 *	\return
+			 *		The integer.
+			 */
+			constexpr IntegerType Get () const noexcept {
+			
+				return i;
+			
+			}
+			
+			
+			/**
+			 *	Retrieves the integer this safe integer represents
+			 *	safely converted to an integer of another type.
+			 *
+			 *	\tparam T
+			 *		The other type.
+			 *
+			 *	\return
+			 *		The integer.
+			 */
+			template <typename T>
+			SAFE_CONSTEXPR14 T Get () const noexcept(noexcept(Cast<T,Policy>(std::declval<IntegerType>()))) {
+			
+				return Cast<T,Policy>(i);
+			
+			}
+			
+			
+			/**
+			 *	Safely converts this safe integer to a safe integer of
+			 *	signed type.
+			 *
+			 *	\return
+			 *		A safe integer which wraps an integer type of
+			 *		the same width as \em IntegerType, except signed,
+			 *		and which contains the same value as this safe
+			 *		integer.
+			 */
+			SAFE_CONSTEXPR14 Integer<SignedType,Policy> MakeSigned () const noexcept(noexcept(Integer<SignedType,Policy>(std::declval<IntegerType>()))) {
+			
+				return Integer<SignedType,Policy>(i);
+			
+			}
+			
+			
+			/**
+			 *	Safely converts this safe integer to a safe integer of
+			 *	unsigned type.
+			 *
+			 *	\return
+			 *		A safe integer which wraps an integer type of
+			 *		the same width as \em IntegerType, except unsigned,
+			 *		and which contains the same value as this safe
+			 *		integer.
+			 */
+			SAFE_CONSTEXPR14 Integer<UnsignedType,Policy> MakeUnsigned () const noexcept(noexcept(Integer<UnsignedType,Policy>(std::declval<IntegerType>()))) {
+			
+				return Integer<UnsignedType,Policy>(i);
+			
+			}
+			
+			
+			/**
+			 *	Finds the absolute value (i.e. magnitude) of a safe integer.
+			 *
+			 *	\return
+			 *		A safe integer containing the magnitude of this safe
+			 *		integer.
+			 */
+			SAFE_CONSTEXPR14 Integer Abs () const {
+			
+				return Arithmetic<IntegerType,Policy>::Abs(i);
+			
+			}
+			
+			
+			/**
+			 *	Finds the absolute value (i.e. magnitude) of a safe integer
+			 *	as an unsigned integer.
+			 *
+			 *	Since the magnitude of any integer may be represented by
+			 *	the unsigned type of the same width, this never overflows.
+			 *
+			 *	\return
+			 *		A safe integer of unsigned type containing the
+			 *		magnitude of this safe integer.
+			 */
+			constexpr Integer<UnsignedType,Policy> UnsignedAbs () const noexcept {
+			
+				return Integer<UnsignedType,Policy>(Arithmetic<IntegerType,Policy>::UnsignedAbs(i));
+			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	//	The magnitude of any integer, which is represented
+	//	exactly since no integer is wider than std::uintmax_t
+	template <typename U>
+	constexpr std::uintmax_t Magnitude (U i) noexcept {
+	
+		return IsNegative(i) ? static_cast<std::uintmax_t>(std::uintmax_t(0)-static_cast<std::uintmax_t>(i)) : static_cast<std::uintmax_t>(i);
+	
+	}
+	
+	
+	//	Stores the integer with sign negative and magnitude m
+	//	in r, returning true if it could not be represented by T
+	//	(or if overflowed is set, meaning that the magnitude
+	//	itself overflowed), in which case r holds the integer
+	//	wrapped modulo 2^N, and d the direction in which it went
+	//	out of range
+	template <typename T>
+	SAFE_CONSTEXPR14 bool MagnitudeOverflows (bool negative, std::uintmax_t m, bool overflowed, T & r, Direction & d) noexcept {
+	
+		typedef typename std::make_unsigned<T>::type unsigned_type;
+		
+		r=static_cast<T>(static_cast<unsigned_type>(negative ? static_cast<std::uintmax_t>(std::uintmax_t(0)-m) : m));
+		d=negative ? Direction::Below : Direction::Above;
+		
+		return overflowed || (m>(negative ? Magnitude(std::numeric_limits<T>::min()) : static_cast<std::uintmax_t>(std::numeric_limits<T>::max())));
+	
+	}
+	
+	
+	//	Multiplies a and b, storing the product in h and l such
+	//	that it's h*2^W+l (where W is the width of
+	//	std::uintmax_t)
+	SAFE_CONSTEXPR14 inline void WideMultiply (std::uintmax_t a, std::uintmax_t b, std::uintmax_t & h, std::uintmax_t & l) noexcept {
+	
+		constexpr int half=std::numeric_limits<std::uintmax_t>::digits/2;
+		constexpr std::uintmax_t mask=(std::uintmax_t(1)<<half)-1;
+		std::uintmax_t low=(a&mask)*(b&mask);
+		std::uintmax_t cross_a=(a>>half)*(b&mask);
+		std::uintmax_t cross_b=(a&mask)*(b>>half);
+		std::uintmax_t middle=(low>>half)+(cross_a&mask)+(cross_b&mask);
+		l=(middle<<half)|(low&mask);
+		h=((a>>half)*(b>>half))+(cross_a>>half)+(cross_b>>half)+(middle>>half);
+	
+	}
+	
+	
+	//	Adds the integer with sign negative_b and magnitude b to
+	//	the integer with sign negative and magnitude h*2^W+l
+	SAFE_CONSTEXPR14 inline void WideAdd (bool & negative, std::uintmax_t & h, std::uintmax_t & l, bool negative_b, std::uintmax_t b) noexcept {
+	
+		if (negative==negative_b) {
+		
+			l+=b;
+			if (l<b) ++h;
+			return;
+		
+		}
+		
+		if ((h!=0) || (l>=b)) {
+		
+			if (l<b) --h;
+			l-=b;
+			return;
+		
+		}
+		
+		negative=negative_b;
+		l=b-l;
+	
+	}
+	
+	
+	//	Divides h*2^W+l by c, which must not be zero, storing
+	//	the quotient in h and l and returning the remainder
+	SAFE_CONSTEXPR14 inline std::uintmax_t WideDivide (std::uintmax_t & h, std::uintmax_t & l, std::uintmax_t c) noexcept {
+	
+		constexpr int digits=std::numeric_limits<std::uintmax_t>::digits;
+		std::uintmax_t m=h%c;
+		h/=c;
+		//	Long division of the low half, the bits of which are
+		//	shifted out of l as the bits of the quotient are
+		//	shifted in
+		for (int i=0;i<digits;++i) {
+		
+			bool carry=(m>>(digits-1))!=0;
+			m=(m<<1)|(l>>(digits-1));
+			l<<=1;
+			if (carry || (m>=c)) {
+			
+				m-=c;
+				l|=1;
+			
+			}
+		
+		}
+		
+		return m;
+	
+	}
+	
+	
+	//	Obtains an operand of an operation on an integer of
+	//	type T and integers of any type, which is converted to T
+	//	only if it isn't an integer (i.e. a bounded integer)
+	template <typename T, typename Policy, typename U>
+	constexpr typename std::enable_if<std::is_integral<U>::value,U>::type MixedOperand (U i) noexcept {
+	
+		return i;
+	
+	}
+	
+	
+	template <typename T, typename Policy, typename U>
+	SAFE_CONSTEXPR14 typename std::enable_if<!std::is_integral<U>::value,T>::type MixedOperand (U i) {
+	
+		return Cast<T,Policy>(i);
+	
+	}
+	
+	
+	//	Obtains the right hand side of a bitwise operation on an
+	//	integer of type T, which is a bit pattern and therefore
+	//	converted to T modulo 2^N (so that a mask wider than T,
+	//	or of the opposite signedness, keeps its low bits)
+	template <typename T, typename Policy, typename U>
+	SAFE_CONSTEXPR14 T BitwiseOperand (U i) {
+	
+		return static_cast<T>(MixedOperand<T,Policy>(i));
+	
+	}
+	
+	
+	//	Performs arithmetic on an integer of type T and an
+	//	integer of any type, so that policies which yield a
+	//	value (e.g. Safe::Saturate and Safe::Wrap) are applied
+	//	to the result rather than to converting the right hand
+	//	side to T
+	//
+	//	When the right hand side is out of range of T each
+	//	operand is represented by its sign and magnitude, so
+	//	that the result is exact (or exact modulo 2^N when it's
+	//	out of range) whatever the types of the operands
+	//
+	//	Right hand sides which aren't integers (i.e. bounded
+	//	integers), and all right hand sides when the policy
+	//	converts first (e.g. Safe::Throw), are converted to T
+	template <typename T, typename Policy>
+	class MixedArithmetic {
+	
+	
+		private:
+		
+		
+			template <typename U>
+			SAFE_CONSTEXPR14 static T result (Operation op, T a, U b, bool negative, std::uintmax_t m, bool overflowed) {
+			
+				T r=0;
+				Direction d=Direction::Above;
+				if (SAFE_UNLIKELY(MagnitudeOverflows(negative,m,overflowed,r,d))) return Policy::Overflow(r,d,op,a,b);
+				
+				return r;
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static T sum (Operation op, T a, U b, bool na, std::uintmax_t ma, bool nb, std::uintmax_t mb) {
+			
+				if (na==nb) {
+				
+					auto m=static_cast<std::uintmax_t>(ma+mb);
+					
+					return result(op,a,b,na,m,m<ma);
+				
+				}
+				
+				return (ma>=mb) ? result(op,a,b,na,static_cast<std::uintmax_t>(ma-mb),false) : result(op,a,b,nb,static_cast<std::uintmax_t>(mb-ma),false);
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static T multiply (T a, U b) {
+			
+				std::uintmax_t m=0;
+				bool overflowed=MultiplyOverflows(Magnitude(a),Magnitude(b),m);
+				
+				return result(Operation::Multiply,a,b,IsNegative(a)!=IsNegative(b),m,overflowed);
+			
+			}
+		
+		
+		public:
+		
+		
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<std::is_integral<U>::value && !ConvertsFirst<Policy>::value,T>::type Add (T a, U b) {
+			
+				if (SAFE_UNLIKELY(!InRange<T>(b))) return sum(Operation::Add,a,b,IsNegative(a),Magnitude(a),IsNegative(b),Magnitude(b));
+				
+				return Arithmetic<T,Policy>::Add(a,static_cast<T>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<!std::is_integral<U>::value || ConvertsFirst<Policy>::value,T>::type Add (T a, U b) {
+			
+				return Arithmetic<T,Policy>::Add(a,Cast<T,Policy>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<std::is_integral<U>::value && !ConvertsFirst<Policy>::value,T>::type Subtract (T a, U b) {
+			
+				if (SAFE_UNLIKELY(!InRange<T>(b))) return sum(Operation::Subtract,a,b,IsNegative(a),Magnitude(a),!IsNegative(b),Magnitude(b));
+				
+				return Arithmetic<T,Policy>::Subtract(a,static_cast<T>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<!std::is_integral<U>::value || ConvertsFirst<Policy>::value,T>::type Subtract (T a, U b) {
+			
+				return Arithmetic<T,Policy>::Subtract(a,Cast<T,Policy>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<std::is_integral<U>::value && !ConvertsFirst<Policy>::value,T>::type Multiply (T a, U b) {
+			
+				if (SAFE_UNLIKELY(!InRange<T>(b))) return multiply(a,b);
+				
+				return Arithmetic<T,Policy>::Multiply(a,static_cast<T>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<!std::is_integral<U>::value || ConvertsFirst<Policy>::value,T>::type Multiply (T a, U b) {
+			
+				return Arithmetic<T,Policy>::Multiply(a,Cast<T,Policy>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<std::is_integral<U>::value && !ConvertsFirst<Policy>::value,T>::type Divide (T a, U b) {
+			
+				//	Zero is in range of every integer type, so the
+				//	magnitude of b is never zero
+				if (SAFE_UNLIKELY(!InRange<T>(b))) return result(Operation::Divide,a,b,IsNegative(a)!=IsNegative(b),static_cast<std::uintmax_t>(Magnitude(a)/Magnitude(b)),false);
+				
+				return Arithmetic<T,Policy>::Divide(a,static_cast<T>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<!std::is_integral<U>::value || ConvertsFirst<Policy>::value,T>::type Divide (T a, U b) {
+			
+				return Arithmetic<T,Policy>::Divide(a,Cast<T,Policy>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<std::is_integral<U>::value && !ConvertsFirst<Policy>::value,T>::type Modulus (T a, U b) {
+			
+				if (SAFE_UNLIKELY(!InRange<T>(b))) return result(Operation::Modulus,a,b,IsNegative(a),static_cast<std::uintmax_t>(Magnitude(a)%Magnitude(b)),false);
+				
+				return Arithmetic<T,Policy>::Modulus(a,static_cast<T>(b));
+			
+			}
+			
+			
+			template <typename U>
+			SAFE_CONSTEXPR14 static typename std::enable_if<!std::is_integral<U>::value || ConvertsFirst<Policy>::value,T>::type Modulus (T a, U b) {
+			
+				return Arithmetic<T,Policy>::Modulus(a,Cast<T,Policy>(b));
+			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Adds \em a and \em b, and assigns the result of the
+	 *	addition to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator += (Integer<A,P> & a, B b) {
+	
+		return a=MixedArithmetic<A,P>::Add(a.Get(),b);
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b, and assigns the result of the
+	 *	addition to \em a.
+	 *
+	 *	This overload activates when \em a and \em b are of the
+	 *	same type, and as such no conversion is necessary.
+	 *
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a and \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator += (Integer<T,P> & a, Integer<T,P> b) {
+	
+		return a=Arithmetic<T,P>::Add(a.Get(),b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b, and assigns the result of the
+	 *	addition to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator += (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a+=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b, and assigns the result of the
+	 *	addition to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 A & operator += (A & a, Integer<B,P> b) {
+	
+		return a=MixedArithmetic<A,P>::Add(a,b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator + (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a+=b;
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator + (Integer<A,P> a, B b) {
+	
+		return a+=b;
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 Integer<A,P> operator + (A a, Integer<B,P> b) {
+	
+		return a+=b;
+	
+	}
+	
+	
+	/**
+	 *	Increments a safe integer.
+	 *
+	 *	\tparam T
+	 *		The integer type of the safe integer.
+	 *	\tparam P
+	 *		The overflow policy of the safe integer.
+	 *
+	 *	\param [in,out] i
+	 *		The safe integer.
+	 *
+	 *	\return
+	 *		The safe integer.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator ++ (Integer<T,P> & i) {
+	
+		return i=Arithmetic<T,P>::Increment(i.Get());
+	
+	}
+	
+	
+	/**
+	 *	Increments a safe integer.
+	 *
+	 *	\tparam T
+	 *		The integer type of the safe integer.
+	 *	\tparam P
+	 *		The overflow policy of the safe integer.
+	 *
+	 *	\param [in,out] i
+	 *		The safe integer.
+	 *
+	 *	\return
+	 *		A copy of the safe integer before it was
+	 *		incremented.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> operator ++ (Integer<T,P> & i, int) {
+	
+		auto retr=i;
+		
+		++i;
+		
+		return retr;
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em a and \em b, and assigns the result of the
+	 *	subtraction to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator -= (Integer<A,P> & a, B b) {
+	
+		return a=MixedArithmetic<A,P>::Subtract(a.Get(),b);
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em b from \em a, and assigns the result of
+	 *	the subtraction to \em a.
+	 *
+	 *	This overload activates when \em a and \em b are of the
+	 *	same type, and as such no conversion is necessary.
+	 *
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a and \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator -= (Integer<T,P> & a, Integer<T,P> b) {
+	
+		return a=Arithmetic<T,P>::Subtract(a.Get(),b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em a and \em b, and assigns the result of the
+	 *	subtraction to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator -= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a-=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em a and \em b, and assigns the result of the
+	 *	subtraction to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 A & operator -= (A & a, Integer<B,P> b) {
+	
+		return a=MixedArithmetic<A,P>::Subtract(a,b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator - (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a-=b;
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator - (Integer<A,P> a, B b) {
+	
+		return a-=b;
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 Integer<A,P> operator - (A a, Integer<B,P> b) {
+	
+		return a-=b;
+	
+	}
+	
+	
+	/**
+	 *	Decrements a safe integer.
+	 *
+	 *	\tparam T
+	 *		The integer type of the safe integer.
+	 *	\tparam P
+	 *		The overflow policy of the safe integer.
+	 *
+	 *	\param [in,out] i
+	 *		The safe integer.
+	 *
+	 *	\return
+	 *		The safe integer.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator -- (Integer<T,P> & i) {
+	
+		return i=Arithmetic<T,P>::Decrement(i.Get());
+	
+	}
+	
+	
+	/**
+	 *	Decrements a safe integer.
+	 *
+	 *	\tparam T
+	 *		The integer type of the safe integer.
+	 *	\tparam P
+	 *		The overflow policy of the safe integer.
+	 *
+	 *	\param [in,out] i
+	 *		The safe integer.
+	 *
+	 *	\return
+	 *		A copy of the safe integer before it was
+	 *		decremented.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> operator -- (Integer<T,P> & i, int) {
+	
+		auto retr=i;
+		
+		--i;
+		
+		return retr;
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b, and assigns the result of the
+	 *	multiplication to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator *= (Integer<A,P> & a, B b) {
+	
+		return a=MixedArithmetic<A,P>::Multiply(a.Get(),b);
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b, and assigns the result of
+	 *	the multiplication to \em a.
+	 *
+	 *	This overload activates when \em a and \em b are of the
+	 *	same type, and as such no conversion is necessary.
+	 *
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a and \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator *= (Integer<T,P> & a, Integer<T,P> b) {
+	
+		return a=Arithmetic<T,P>::Multiply(a.Get(),b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b, and assigns the result of the
+	 *	multiplication to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator *= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a*=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b, and assigns the result of the
+	 *	multiplication to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 A & operator *= (A & a, Integer<B,P> b) {
+	
+		return a=MixedArithmetic<A,P>::Multiply(a,b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator * (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a*=b;
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator * (Integer<A,P> a, B b) {
+	
+		return a*=b;
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 Integer<A,P> operator * (A a, Integer<B,P> b) {
+	
+		return a*=b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b, and assigns the result of the
+	 *	division to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator /= (Integer<A,P> & a, B b) {
+	
+		return a=MixedArithmetic<A,P>::Divide(a.Get(),b);
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b, and assigns the result of the
+	 *	division to \em a.
+	 *
+	 *	This overload activates when \em a and \em b are of the
+	 *	same type, and as such no conversion is necessary.
+	 *
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a and \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator /= (Integer<T,P> & a, Integer<T,P> b) {
+	
+		return a=Arithmetic<T,P>::Divide(a.Get(),b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b, and assigns the result of the
+	 *	division to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator /= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a/=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b, and assigns the result of the
+	 *	division to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 A & operator /= (A & a, Integer<B,P> b) {
+	
+		return a=MixedArithmetic<A,P>::Divide(a,b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator / (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a/=b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator / (Integer<A,P> a, B b) {
+	
+		return a/=b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 Integer<A,P> operator / (A a, Integer<B,P> b) {
+	
+		return a/=b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b, and assigns the remainder to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator %= (Integer<A,P> & a, B b) {
+	
+		return a=MixedArithmetic<A,P>::Modulus(a.Get(),b);
+	
+	}
+	
+	
+	/**
+	 *	Finds the remainder of dividing \em a by \em b, and
+	 *	assigns the result to \em a.
+	 *
+	 *	This overload activates when \em a and \em b are of the
+	 *	same type, and as such no conversion is necessary.
+	 *
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a and \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator %= (Integer<T,P> & a, Integer<T,P> b) {
+	
+		return a=Arithmetic<T,P>::Modulus(a.Get(),b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b, and assigns the remainder to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator %= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a%=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b, and assigns the remainder to \em a.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 A & operator %= (A & a, Integer<B,P> b) {
+	
+		return a=MixedArithmetic<A,P>::Modulus(a,b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Obtains the remainder of division of \em a by \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator % (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a%=b;
+	
+	}
+	
+	
+	/**
+	 *	Obtains the remainder of division of \em a by \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator % (Integer<A,P> a, B b) {
+	
+		return a%=b;
+	
+	}
+	
+	
+	/**
+	 *	Obtains the remainder of division of \em a by \em b.
+	 *
+	 *	If the policy yields a value on overflow (e.g.
+	 *	Safe::Saturate) the result is computed exactly, even
+	 *	when \em b is out of range of type \em A, and only the
+	 *	result is checked, otherwise \em b is converted to type
+	 *	\em A first.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 Integer<A,P> operator % (A a, Integer<B,P> b) {
+	
+		return a%=b;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is equal to another
+	 *	safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side
+	 *		of the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is equal to \em b, \em false otherwise. 
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	constexpr bool operator == (Integer<A,PA> a, Integer<B,PB> b) noexcept {
+	
+		return IsEqual(a.Get(),b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is equal to
+	 *	some integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side of the
+	 *		comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is equal to \em b, \em false otherwise. 
+	 */
+	template <typename A, typename P, typename B>
+	constexpr bool operator == (Integer<A,P> a, B b) noexcept {
+	
+		return IsEqual(a.Get(),b);
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some integer \em a is equal to
+	 *	some safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is equal to \em b, \em false otherwise. 
+	 */
+	template <typename A, typename B, typename P>
+	constexpr bool operator == (A a, Integer<B,P> b) noexcept {
+	
+		return IsEqual(a,b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is not equal to another
+	 *	safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side
+	 *		of the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is not equal to \em b, \em false otherwise. 
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	constexpr bool operator != (Integer<A,PA> a, Integer<B,PB> b) noexcept {
+	
+		return !(a==b);
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is not equal to
+	 *	some integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side of the
+	 *		comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is not equal to \em b, \em false otherwise. 
+	 */
+	template <typename A, typename P, typename B>
+	constexpr bool operator != (Integer<A,P> a, B b) noexcept {
+	
+		return !(a==b);
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some integer \em a is not equal to
+	 *	some safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is not equal to \em b, \em false otherwise. 
+	 */
+	template <typename A, typename B, typename P>
+	constexpr bool operator != (A a, Integer<B,P> b) noexcept {
+	
+		return !(a==b);
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is greater than
+	 *	another safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side
+	 *		of the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is greater than \em b, \em false otherwise. 
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	constexpr bool operator > (Integer<A,PA> a, Integer<B,PB> b) noexcept {
+	
+		return Compare(a.Get(),b.Get())>0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is greater than
+	 *	some integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side of the
+	 *		comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is greater than \em b, \em false otherwise. 
+	 */
+	template <typename A, typename P, typename B>
+	constexpr bool operator > (Integer<A,P> a, B b) noexcept {
+	
+		return Compare(a.Get(),b)>0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some integer \em a is greater than
+	 *	some safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is greater than \em b, \em false otherwise. 
+	 */
+	template <typename A, typename B, typename P>
+	constexpr bool operator > (A a, Integer<B,P> b) noexcept {
+	
+		return Compare(a,b.Get())>0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is greater than
+	 *	or equal to another safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side
+	 *		of the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is greater than or equal to \em b, \em false
+	 *		otherwise. 
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	constexpr bool operator >= (Integer<A,PA> a, Integer<B,PB> b) noexcept {
+	
+		return Compare(a.Get(),b.Get())>=0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is greater than
+	 *	or equal to some integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side of the
+	 *		comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is greater than or equal to \em b, \em false
+	 *		otherwise. 
+	 */
+	template <typename A, typename P, typename B>
+	constexpr bool operator >= (Integer<A,P> a, B b) noexcept {
+	
+		return Compare(a.Get(),b)>=0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some integer \em a is greater than
+	 *	or equal to some safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is greater than or equal to \em b, \em false
+	 *		otherwise. 
+	 */
+	template <typename A, typename B, typename P>
+	constexpr bool operator >= (A a, Integer<B,P> b) noexcept {
+	
+		return Compare(a,b.Get())>=0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is less than
+	 *	another safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side
+	 *		of the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is less than \em b, \em false otherwise. 
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	constexpr bool operator < (Integer<A,PA> a, Integer<B,PB> b) noexcept {
+	
+		return Compare(a.Get(),b.Get())<0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is less than
+	 *	some integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side of the
+	 *		comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is less than \em b, \em false otherwise. 
+	 */
+	template <typename A, typename P, typename B>
+	constexpr bool operator < (Integer<A,P> a, B b) noexcept {
+	
+		return Compare(a.Get(),b)<0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some integer \em a is less than
+	 *	some safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is less than \em b, \em false otherwise. 
+	 */
+	template <typename A, typename B, typename P>
+	constexpr bool operator < (A a, Integer<B,P> b) noexcept {
+	
+		return Compare(a,b.Get())<0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is less than
+	 *	or equal to another safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side
+	 *		of the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is less than or equal to \em b, \em false
+	 *		otherwise. 
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	constexpr bool operator <= (Integer<A,PA> a, Integer<B,PB> b) noexcept {
+	
+		return Compare(a.Get(),b.Get())<=0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some safe integer \em a is less than
+	 *	or equal to some integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side of the
+	 *		comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is less than or equal to \em b, \em false
+	 *		otherwise. 
+	 */
+	template <typename A, typename P, typename B>
+	constexpr bool operator <= (Integer<A,P> a, B b) noexcept {
+	
+		return Compare(a.Get(),b)<=0;
+	
+	}
+	
+	
+	/**
+	 *	Determines whether some integer \em a is less than
+	 *	or equal to some safe integer \em b.
+	 *
+	 *	Comparing integers of different width and signedness
+	 *	using this operator results in well-defined and mathematically
+	 *	correct results.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side of
+	 *		the comparison.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side
+	 *		of the comparison.
+	 *
+	 *	\return
+	 *		\em true if \em a is less than or equal to \em b, \em false
+	 *		otherwise. 
+	 */
+	template <typename A, typename B, typename P>
+	constexpr bool operator <= (A a, Integer<B,P> b) noexcept {
+	
+		return Compare(a,b.Get())<=0;
+	
+	}
+	
+	
+	/**
+	 *	Applies unary plus to a safe integer.
+	 *
+	 *	\tparam T
+	 *		The integer type of the safe integer type.
+	 *	\tparam P
+	 *		The overflow policy of the safe integer.
+	 *
+	 *	\param [in] a
+	 *		The safe integer.
+	 *
+	 *	\return
+	 *		\em a.
+	 */
+	template <typename T, typename P>
+	constexpr Integer<T,P> operator + (Integer<T,P> a) noexcept {
+	
+		return a;
+	
+	}
+	
+	
+	/**
+	 *	Applies unary minus to a safe integer.
+	 *
+	 *	This overload activates when the safe integer
+	 *	type-in-question is unsigned.  In this case
+	 *	the overflow policy is invoked unless the safe
+	 *	integer-in-question is exactly zero.
+	 *
+	 *	\tparam T
+	 *		The integer type of the safe integer type.
+	 *	\tparam P
+	 *		The overflow policy of the safe integer.
+	 *
+	 *	\param [in] a
+	 *		The safe integer.
+	 *
+	 *	\return
+	 *		Zero.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 typename std::enable_if<Integer<T,P>::Unsigned,Integer<T,P>>::type operator - (Integer<T,P> a) {
+	
+		if (SAFE_UNLIKELY(a!=0)) return P::Overflow(static_cast<T>(T(0)-a.Get()),Direction::Below,Operation::Negate,a.Get());
+		
+		return a;
+	
+	}
+	
+	
+	/**
+	 *	Applies unary minus to a safe integer.
+	 *
+	 *	This overload activates when the safe integer
+	 *	type-in-question is signed.
+	 *
+	 *	\tparam T
+	 *		The integer type of the safe integer type.
+	 *	\tparam P
+	 *		The overflow policy of the safe integer.
+	 *
+	 *	\param [in] a
+	 *		The safe integer.
+	 *
+	 *	\return
+	 *		The negation of \em a.
+	 */
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 typename std::enable_if<Integer<T,P>::Signed,Integer<T,P>>::type operator - (Integer<T,P> a) {
+	
+		return Arithmetic<T,P>::Negate(a.Get());
+	
+	}
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	template <typename T, typename Policy>
+	class Shift {
+	
+	
+		private:
+		
+		
+			typedef typename std::make_unsigned<T>::type type;
+			
+			
+			//	The number of bits in T (including the sign bit),
+			//	which is a power of two
+			static constexpr unsigned int width=std::numeric_limits<type>::digits;
+			
+			
+			//	Negative counts become very large once they're
+			//	unsigned, so that one comparison rejects both
+			template <typename C>
+			static constexpr bool count_overflows (C count) noexcept {
+			
+				return static_cast<typename std::make_unsigned<C>::type>(count)>=width;
+			
+			}
+			
+			
+			//	Masking the count keeps shifting defined when
+			//	it's out of range (in which case it's rejected
+			//	regardless of the result)
+			template <typename C>
+			static constexpr unsigned int mask (C count) noexcept {
+			
+				return static_cast<unsigned int>(count)&(width-1);
+			
+			}
+		
+		
+		public:
+		
+		
+			template <typename C>
+			SAFE_CONSTEXPR14 static T Left (T a, C count) {
+			
+				auto shift=mask(count);
+				auto r=static_cast<T>(static_cast<type>(static_cast<type>(a)<<shift));
+				//	No bits are lost (and a is not negative) if
+				//	and only if a, as unsigned, is no greater than
+				//	the maximum shifted right
+				bool overflowed=count_overflows(count);
+				overflowed|=static_cast<type>(a)>static_cast<type>(static_cast<type>(std::numeric_limits<T>::max())>>shift);
+				//	Shifting a negative integer or by an out of range
+				//	count has no meaningful result
+				bool undefined=count_overflows(count) || IsNegative(a);
+				if (SAFE_UNLIKELY(overflowed)) return Policy::Overflow(
+					undefined ? T(0) : r,
+					undefined ? Direction::Undefined : Direction::Above,
+					Operation::ShiftLeft,
+					a,
+					count
+				);
+				
+				return r;
+			
+			}
+			
+			
+			template <typename C>
+			SAFE_CONSTEXPR14 static T Right (T a, C count) {
+			
+				bool overflowed=count_overflows(count);
+				overflowed|=IsNegative(a);
+				if (SAFE_UNLIKELY(overflowed)) return Policy::Overflow(T(0),Direction::Undefined,Operation::ShiftRight,a,count);
+				
+				return static_cast<T>(a>>mask(count));
+			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Shifts \em a left by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, if \em a is
+	 *	negative, or if any bits would be lost.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator <<= (Integer<A,P> & a, B b) {
+	
+		return a=Shift<A,P>::Left(a.Get(),b);
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a left by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, if \em a is
+	 *	negative, or if any bits would be lost.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator <<= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a<<=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a left by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, if \em a is
+	 *	negative, or if any bits would be lost.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator << (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a<<=b;
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a left by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, if \em a is
+	 *	negative, or if any bits would be lost.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator << (Integer<A,P> a, B b) {
+	
+		return a<<=b;
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a left by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, if \em a is
+	 *	negative, or if any bits would be lost.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_integral<A>::value,Integer<A,P>>::type operator << (A a, Integer<B,P> b) {
+	
+		return Shift<A,P>::Left(a,b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a right by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, or if \em a
+	 *	is negative.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator >>= (Integer<A,P> & a, B b) {
+	
+		return a=Shift<A,P>::Right(a.Get(),b);
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a right by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, or if \em a
+	 *	is negative.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator >>= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a>>=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a right by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, or if \em a
+	 *	is negative.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator >> (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a>>=b;
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a right by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, or if \em a
+	 *	is negative.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator >> (Integer<A,P> a, B b) {
+	
+		return a>>=b;
+	
+	}
+	
+	
+	/**
+	 *	Shifts \em a right by \em b bits.
+	 *
+	 *	The policy is invoked if \em b is negative or not
+	 *	less than the number of bits in \em A, or if \em a
+	 *	is negative.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_integral<A>::value,Integer<A,P>>::type operator >> (A a, Integer<B,P> b) {
+	
+		return Shift<A,P>::Right(a,b.Get());
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise AND of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator &= (Integer<A,P> & a, B b) {
+	
+		return a=static_cast<A>(a.Get()&BitwiseOperand<A,P>(b));
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise AND of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator &= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a&=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise AND of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator & (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a&=b;
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise AND of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator & (Integer<A,P> a, B b) {
+	
+		return a&=b;
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise AND of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_integral<A>::value,Integer<A,P>>::type operator & (A a, Integer<B,P> b) {
+	
+		return static_cast<A>(a&BitwiseOperand<A,P>(b.Get()));
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator |= (Integer<A,P> & a, B b) {
+	
+		return a=static_cast<A>(a.Get()|BitwiseOperand<A,P>(b));
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator |= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a|=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator | (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a|=b;
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator | (Integer<A,P> a, B b) {
+	
+		return a|=b;
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_integral<A>::value,Integer<A,P>>::type operator | (A a, Integer<B,P> b) {
+	
+		return static_cast<A>(a|BitwiseOperand<A,P>(b.Get()));
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise exclusive OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> & operator ^= (Integer<A,P> & a, B b) {
+	
+		return a=static_cast<A>(a.Get()^BitwiseOperand<A,P>(b));
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise exclusive OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in,out] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		A reference to \em a.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> & operator ^= (Integer<A,PA> & a, Integer<B,PB> b) {
+	
+		return a^=b.Get();
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise exclusive OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	SAFE_CONSTEXPR14 Integer<A,PA> operator ^ (Integer<A,PA> a, Integer<B,PB> b) {
+	
+		return a^=b;
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise exclusive OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	SAFE_CONSTEXPR14 Integer<A,P> operator ^ (Integer<A,P> a, B b) {
+	
+		return a^=b;
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise exclusive OR of \em a and \em b.
+	 *
+	 *	Note that \em b is converted to type \em A modulo 2^N
+	 *	(where N is the number of bits in \em A), so that only
+	 *	its low bits take part in the operation.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	SAFE_CONSTEXPR14 typename std::enable_if<std::is_integral<A>::value,Integer<A,P>>::type operator ^ (A a, Integer<B,P> b) {
+	
+		return static_cast<A>(a^BitwiseOperand<A,P>(b.Get()));
+	
+	}
+	
+	
+	/**
+	 *	Computes the bitwise complement of a safe integer.
+	 *
+	 *	\tparam T
+	 *		The integer type of the safe integer.
+	 *	\tparam P
+	 *		The overflow policy of the safe integer.
+	 *
+	 *	\param [in] a
+	 *		The safe integer.
+	 *
+	 *	\return
+	 *		The bitwise complement of \em a.
+	 */
+	template <typename T, typename P>
+	constexpr Integer<T,P> operator ~ (Integer<T,P> a) noexcept {
+	
+		return Integer<T,P>(static_cast<T>(~a.Get()));
+	
+	}
+	
+	
+	/**
+	 *	Creates a safe integer by wrapping an integer.
+	 *
+	 *	\tparam T
+	 *		The type of integer to wrap.
+	 *
+	 *	\param [in] i
+	 *		An integer of type \em T.
+	 *
+	 *	\return
+	 *		A safe integer which wraps \em i.
+	 */
+	template <typename T>
+	constexpr Integer<T> Make (T i) noexcept {
+	
+		return Integer<T>(i);
+	
+	}
+	
+	
+	/**
+	 *	The result of an operation which does not throw
+	 *	when it goes out of range.
+	 *
+	 *	\tparam T
+	 *		The type of integer which is the result of the
+	 *		operation.
+	 */
+	template <typename T>
+	class Result {
+	
+	
+		private:
+		
+		
+			T value;
+			bool overflowed;
+		
+		
+		public:
+		
+		
+			/**
+			 *	Creates a result.
+			 *
+			 *	\param [in] value
+			 *		The value of the result.
+			 *	\param [in] overflowed
+			 *		\em true if the operation went out of range,
+			 *		\em false otherwise.
+			 */
+			constexpr Result (T value, bool overflowed) noexcept : value(value), overflowed(overflowed) {	}
+			
+			
+			/**
+			 *	Retrieves the value of the result.
+			 *
+			 *	If the operation went out of range this is the
+			 *	result wrapped modulo 2^N, or zero if the
+			 *	operation was a division or modulus.
+			 *
+			 *	\return
+			 *		The value.
+			 */
+			constexpr T Get () const noexcept {
+			
+				return value;
+			
+			}
+			
+			
+			/**
+			 *	Determines whether the operation went out of
+			 *	range.
+			 *
+			 *	\return
+			 *		\em true if the operation went out of range,
+			 *		\em false otherwise.
+			 */
+			constexpr bool Overflowed () const noexcept {
+			
+				return overflowed;
+			
+			}
+			
+			
+			/**
+			 *	Determines whether the operation succeeded.
+			 *
+			 *	\return
+			 *		\em true if the operation did not go out of
+			 *		range, \em false otherwise.
+			 */
+			constexpr explicit operator bool () const noexcept {
+			
+				return !overflowed;
+			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	template <typename T>
+	class Unwrapped {
+	
+	
+		public:
+		
+		
+			typedef T Type;
+			
+			
+			static constexpr T Get (T i) noexcept {
+			
+				return i;
+			
+			}
+	
+	
+	};
+	
+	
+	template <typename T, typename P>
+	class Unwrapped<Integer<T,P>> {
+	
+	
+		public:
+		
+		
+			typedef T Type;
+			
+			
+			static constexpr T Get (Integer<T,P> i) noexcept {
+			
+				return i.Get();
+			
+			}
+	
+	
+	};
+	
+	
+	//	Converts b to the type of the left hand side of an
+	//	operation, returning true if it's out of range
+	template <typename A, typename B>
+	bool ConvertOverflows (B b, A & r) noexcept {
+	
+		auto i=Unwrapped<B>::Get(b);
+		r=static_cast<A>(i);
+		
+		return !InRange<A>(i);
+	
+	}
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Adds \em a and \em b without throwing.
+	 *
+	 *	Note that \em b is always converted to the integer
+	 *	type of \em a before the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The left hand side.
+	 *	\param [in] b
+	 *		The right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B>
+	Result<typename Unwrapped<A>::Type> TryAdd (A a, B b) noexcept {
+	
+		typedef typename Unwrapped<A>::Type type;
+		
+		type c;
+		type r;
+		//	Both checks are always performed and combined
+		//	without branching
+		bool overflowed=ConvertOverflows(b,c);
+		overflowed|=AddOverflows(Unwrapped<A>::Get(a),c,r);
+		
+		return Result<type>(r,overflowed);
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em b from \em a without throwing.
+	 *
+	 *	Note that \em b is always converted to the integer
+	 *	type of \em a before the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The left hand side.
+	 *	\param [in] b
+	 *		The right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B>
+	Result<typename Unwrapped<A>::Type> TrySubtract (A a, B b) noexcept {
+	
+		typedef typename Unwrapped<A>::Type type;
+		
+		type c;
+		type r;
+		bool overflowed=ConvertOverflows(b,c);
+		overflowed|=SubtractOverflows(Unwrapped<A>::Get(a),c,r);
+		
+		return Result<type>(r,overflowed);
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b without throwing.
+	 *
+	 *	Note that \em b is always converted to the integer
+	 *	type of \em a before the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The left hand side.
+	 *	\param [in] b
+	 *		The right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B>
+	Result<typename Unwrapped<A>::Type> TryMultiply (A a, B b) noexcept {
+	
+		typedef typename Unwrapped<A>::Type type;
+		
+		type c;
+		type r;
+		bool overflowed=ConvertOverflows(b,c);
+		overflowed|=MultiplyOverflows(Unwrapped<A>::Get(a),c,r);
+		
+		return Result<type>(r,overflowed);
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b without throwing.
+	 *
+	 *	Note that \em b is always converted to the integer
+	 *	type of \em a before the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The left hand side.
+	 *	\param [in] b
+	 *		The right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B>
+	Result<typename Unwrapped<A>::Type> TryDivide (A a, B b) noexcept {
+	
+		typedef typename Unwrapped<A>::Type type;
+		
+		type c;
+		auto i=Unwrapped<A>::Get(a);
+		//	The division cannot be performed at all if it
+		//	would overflow, since division by zero is
+		//	undefined
+		if (ConvertOverflows(b,c) || DivideOverflows(i,c)) return Result<type>(0,true);
+		
+		return Result<type>(i/c,false);
+	
+	}
+	
+	
+	/**
+	 *	Finds the remainder of dividing \em a by \em b without
+	 *	throwing.
+	 *
+	 *	Note that \em b is always converted to the integer
+	 *	type of \em a before the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The left hand side.
+	 *	\param [in] b
+	 *		The right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B>
+	Result<typename Unwrapped<A>::Type> TryModulus (A a, B b) noexcept {
+	
+		typedef typename Unwrapped<A>::Type type;
+		
+		type c;
+		auto i=Unwrapped<A>::Get(a);
+		if (ConvertOverflows(b,c) || DivideOverflows(i,c)) return Result<type>(0,true);
+		
+		return Result<type>(i%c,false);
+	
+	}
+	
+	
+	/**
+	 *	Casts from one integer type to another without
+	 *	throwing.
+	 *
+	 *	\tparam B
+	 *		The type of integer to cast to.
+	 *	\tparam A
+	 *		The type of \em from, which may be an integer or
+	 *		a safe integer.
+	 *
+	 *	\param [in] from
+	 *		The integer to cast.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename B, typename A>
+	Result<B> TryCast (A from) noexcept {
+	
+		B r;
+		bool overflowed=ConvertOverflows(from,r);
+		
+		return Result<B>(r,overflowed);
+	
+	}
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	//	Finds the overflow policy of the first safe integer
+	//	in Ts, or Safe::Throw if there isn't one
+	template <typename... Ts>
+	class FirstPolicy {
+	
+	
+		public:
+		
+		
+			typedef Throw Type;
+	
+	
+	};
+	
+	
+	template <typename T, typename P, typename... Ts>
+	class FirstPolicy<Integer<T,P>,Ts...> {
+	
+	
+		public:
+		
+		
+			typedef P Type;
+	
+	
+	};
+	
+	
+	template <typename T, typename... Ts>
+	class FirstPolicy<T,Ts...> : public FirstPolicy<Ts...> {	};
+	
+	
+	//	Multiplies a and b and adds c to (or subtracts c from)
+	//	the product exactly, for when b or c is out of range of
+	//	T
+	template <bool Subtract, typename Policy, typename T, typename B, typename C>
+	SAFE_CONSTEXPR14 T MixedMultiplyAdd (T a, B b, C c) {
+	
+		bool negative=IsNegative(a)!=IsNegative(b);
+		std::uintmax_t h=0;
+		std::uintmax_t l=0;
+		WideMultiply(Magnitude(a),Magnitude(b),h,l);
+		WideAdd(negative,h,l,IsNegative(c)!=Subtract,Magnitude(c));
+		T r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(MagnitudeOverflows(negative,l,h!=0,r,d))) return Policy::Overflow(r,d,Subtract ? Operation::MultiplySubtract : Operation::MultiplyAdd,a,b,c);
+		
+		return r;
+	
+	}
+	
+	
+	template <bool Subtract, typename A, typename B, typename C>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B,C>::Type> MultiplyAdd (A a, B b, C c) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A,B,C>::Type policy;
+		
+		type x=Unwrapped<A>::Get(a);
+		auto y=MixedOperand<type,policy>(Unwrapped<B>::Get(b));
+		auto z=MixedOperand<type,policy>(Unwrapped<C>::Get(c));
+		if (SAFE_UNLIKELY(!InRange<type>(y) || !InRange<type>(z))) return MixedMultiplyAdd<Subtract,policy>(x,y,z);
+		
+		type r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(MultiplyAddOverflows<Subtract>(x,static_cast<type>(y),static_cast<type>(z),r,d))) return policy::Overflow(r,d,Subtract ? Operation::MultiplySubtract : Operation::MultiplyAdd,x,y,z);
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Multiplies \em a and \em b and adds \em c to the product,
+	 *	checking only once whether the result is in range.
+	 *
+	 *	The product need not be representable, so long as the
+	 *	result is, except for 64 bit integers when there's no 128
+	 *	bit integer type.
+	 *
+	 *	\em b and \em c need not be representable by the integer
+	 *	type of \em a, in which case the result is computed
+	 *	exactly before it's checked.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam C
+	 *		The type of \em c, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The multiplicand.
+	 *	\param [in] b
+	 *		The multiplier.
+	 *	\param [in] c
+	 *		The addend.
+	 *
+	 *	\return
+	 *		A safe integer which has the overflow policy of the
+	 *		first safe integer among the operands (Safe::Throw if
+	 *		there isn't one).
+	 */
+	template <typename A, typename B, typename C>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B,C>::Type> MulAdd (A a, B b, C c) {
+	
+		return MultiplyAdd<false>(a,b,c);
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b and subtracts \em c from the
+	 *	product, checking only once whether the result is in range.
+	 *
+	 *	The product need not be representable, so long as the
+	 *	result is, except for 64 bit integers when there's no 128
+	 *	bit integer type.
+	 *
+	 *	\em b and \em c need not be representable by the integer
+	 *	type of \em a, in which case the result is computed
+	 *	exactly before it's checked.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam C
+	 *		The type of \em c, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The multiplicand.
+	 *	\param [in] b
+	 *		The multiplier.
+	 *	\param [in] c
+	 *		The subtrahend.
+	 *
+	 *	\return
+	 *		A safe integer which has the overflow policy of the
+	 *		first safe integer among the operands (Safe::Throw if
+	 *		there isn't one).
+	 */
+	template <typename A, typename B, typename C>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B,C>::Type> MulSub (A a, B b, C c) {
+	
+		return MultiplyAdd<true>(a,b,c);
+	
+	}
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	//	The number of bits by which the sum of n integers
+	//	may be wider than the integers themselves
+	constexpr std::size_t CarryBits (std::size_t n) noexcept {
+	
+		return (n<=1) ? 0 : (1+CarryBits((n+1)/2));
+	
+	}
+	
+	
+	//	Finds an integer type in which the sum of Count integers
+	//	of type T cannot overflow, if there is one
+	template <typename T, std::size_t Count>
+	class SumAccumulator : public AtLeast<T,sizeof(T)+((CarryBits(Count)+7)/8)> {	};
+	
+	
+	//	Finds an integer type in which the product of Count
+	//	integers of type T cannot overflow, if there is one
+	template <typename T, std::size_t Count>
+	class ProductAccumulator : public AtLeast<T,sizeof(T)*Count> {	};
+	
+	
+	//	Sums is and stores the result in r, returning true if
+	//	it could not be represented by T (in which case r holds
+	//	the result wrapped modulo 2^N, and d the direction in
+	//	which it went out of range)
+	//
+	//	When there's a type in which the sum cannot overflow it's
+	//	accumulated in that type and only the result is range
+	//	checked
+	template <typename T, typename... Ts>
+	SAFE_CONSTEXPR14 typename std::enable_if<SumAccumulator<T,sizeof...(Ts)>::Exists,bool>::type SumOverflows (T & r, Direction & d, Ts... is) noexcept {
+	
+		typedef typename SumAccumulator<T,sizeof...(Ts)>::Type type;
+		
+		const T values []={is...};
+		type s=0;
+		for (auto i : values) s=static_cast<type>(s+static_cast<type>(i));
+		r=static_cast<T>(s);
+		d=(s<0) ? Direction::Below : Direction::Above;
+		
+		return (s>static_cast<type>(std::numeric_limits<T>::max())) || (std::is_signed<T>::value && (s<static_cast<type>(std::numeric_limits<T>::min())));
+	
+	}
+	
+	
+	//	Otherwise each addition is checked and the checks are
+	//	combined, which means that each partial sum must also
+	//	be representable
+	template <typename T, typename... Ts>
+	SAFE_CONSTEXPR14 typename std::enable_if<!SumAccumulator<T,sizeof...(Ts)>::Exists,bool>::type SumOverflows (T & r, Direction & d, Ts... is) noexcept {
+	
+		const T values []={is...};
+		r=0;
+		bool overflowed=false;
+		for (auto i : values) {
+		
+			bool o=AddOverflows(r,i,r);
+			if (o) d=IsNegative(i) ? Direction::Below : Direction::Above;
+			overflowed|=o;
+		
+		}
+		
+		return overflowed;
+	
+	}
+	
+	
+	//	As above, except for multiplication
+	template <typename T, typename... Ts>
+	SAFE_CONSTEXPR14 typename std::enable_if<ProductAccumulator<T,sizeof...(Ts)>::Exists,bool>::type ProductOverflows (T & r, Direction & d, Ts... is) noexcept {
+	
+		typedef typename ProductAccumulator<T,sizeof...(Ts)>::Type type;
+		
+		const T values []={is...};
+		type p=1;
+		for (auto i : values) p=static_cast<type>(p*static_cast<type>(i));
+		r=static_cast<T>(p);
+		d=(p<0) ? Direction::Below : Direction::Above;
+		
+		return (p>static_cast<type>(std::numeric_limits<T>::max())) || (std::is_signed<T>::value && (p<static_cast<type>(std::numeric_limits<T>::min())));
+	
+	}
+	
+	
+	template <typename T, typename... Ts>
+	SAFE_CONSTEXPR14 typename std::enable_if<!ProductAccumulator<T,sizeof...(Ts)>::Exists,bool>::type ProductOverflows (T & r, Direction & d, Ts... is) noexcept {
+	
+		const T values []={is...};
+		r=1;
+		bool overflowed=false;
+		bool negative=false;
+		for (auto i : values) {
+		
+			overflowed|=MultiplyOverflows(r,i,r);
+			negative^=IsNegative(i);
+		
+		}
+		d=negative ? Direction::Below : Direction::Above;
+		
+		return overflowed;
+	
+	}
+	
+	
+	//	Determines whether every one of is is in range of T
+	template <typename T>
+	constexpr bool AllInRange () noexcept {
+	
+		return true;
+	
+	}
+	
+	
+	template <typename T, typename U, typename... Us>
+	constexpr bool AllInRange (U i, Us... is) noexcept {
+	
+		return InRange<T>(i) && AllInRange<T>(is...);
+	
+	}
+	
+	
+	//	Sums a and is exactly, for when any of is is out of
+	//	range of T
+	template <typename Policy, typename T, typename... Ts>
+	SAFE_CONSTEXPR14 T MixedSum (T a, Ts... is) {
+	
+		const bool negatives []={IsNegative(a),IsNegative(is)...};
+		const std::uintmax_t magnitudes []={Magnitude(a),Magnitude(is)...};
+		bool negative=false;
+		std::uintmax_t h=0;
+		std::uintmax_t l=0;
+		for (std::size_t i=0;i<=sizeof...(Ts);++i) WideAdd(negative,h,l,negatives[i],magnitudes[i]);
+		T r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(MagnitudeOverflows(negative,l,h!=0,r,d))) return Policy::Overflow(r,d,Operation::Sum,r);
+		
+		return r;
+	
+	}
+	
+	
+	template <typename Policy, typename T, typename... Ts>
+	SAFE_CONSTEXPR14 T SumOf (T a, Ts... is) {
+	
+		if (SAFE_UNLIKELY(!AllInRange<T>(is...))) return MixedSum<Policy>(a,is...);
+		
+		T r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(SumOverflows(r,d,a,static_cast<T>(is)...))) return Policy::Overflow(r,d,Operation::Sum,r);
+		
+		return r;
+	
+	}
+	
+	
+	//	As above, except for multiplication
+	//
+	//	The magnitude of the product only grows, so once it
+	//	overflows the product is out of range unless one of the
+	//	factors is zero
+	template <typename Policy, typename T, typename... Ts>
+	SAFE_CONSTEXPR14 T MixedProduct (T a, Ts... is) {
+	
+		const bool negatives []={IsNegative(a),IsNegative(is)...};
+		const std::uintmax_t magnitudes []={Magnitude(a),Magnitude(is)...};
+		bool negative=false;
+		std::uintmax_t m=1;
+		bool overflowed=false;
+		bool zero=false;
+		for (std::size_t i=0;i<=sizeof...(Ts);++i) {
+		
+			overflowed|=MultiplyOverflows(m,magnitudes[i],m);
+			negative^=negatives[i];
+			zero|=magnitudes[i]==0;
+		
+		}
+		T r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(MagnitudeOverflows(negative,m,overflowed && !zero,r,d))) return Policy::Overflow(r,d,Operation::Product,r);
+		
+		return r;
+	
+	}
+	
+	
+	template <typename Policy, typename T, typename... Ts>
+	SAFE_CONSTEXPR14 T ProductOf (T a, Ts... is) {
+	
+		if (SAFE_UNLIKELY(!AllInRange<T>(is...))) return MixedProduct<Policy>(a,is...);
+		
+		T r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(ProductOverflows(r,d,a,static_cast<T>(is)...))) return Policy::Overflow(r,d,Operation::Product,r);
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Adds any number of integers, checking only once whether
+	 *	the result is in range.
+	 *
+	 *	The sum is accumulated in a type wide enough that it
+	 *	cannot overflow, so the partial sums need not be
+	 *	representable, so long as the result is.  If there's no
+	 *	such type (i.e. summing 64 bit integers when there's no
+	 *	128 bit integer type) every partial sum must also be
+	 *	representable.
+	 *
+	 *	\em ts need not be representable by the integer type of
+	 *	\em a, in which case the result is computed exactly before
+	 *	it's checked.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam Ts
+	 *		The types of \em ts, each of which may be an integer
+	 *		or a safe integer.
+	 *
+	 *	\param [in] a
+	 *		The first addend.
+	 *	\param [in] ts
+	 *		The remaining addends.
+	 *
+	 *	\return
+	 *		A safe integer which has the overflow policy of the
+	 *		first safe integer among the operands (Safe::Throw if
+	 *		there isn't one).
+	 */
+	template <typename A, typename... Ts>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,Ts...>::Type> Sum (A a, Ts... ts) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A,Ts...>::Type policy;
+		
+		return SumOf<policy>(Unwrapped<A>::Get(a),MixedOperand<type,policy>(Unwrapped<Ts>::Get(ts))...);
+	
+	}
+	
+	
+	/**
+	 *	Multiplies any number of integers, checking only once
+	 *	whether the result is in range.
+	 *
+	 *	The product is accumulated in a type wide enough that it
+	 *	cannot overflow, so the partial products need not be
+	 *	representable, so long as the result is.  If there's no
+	 *	such type every partial product must also be
+	 *	representable.
+	 *
+	 *	\em ts need not be representable by the integer type of
+	 *	\em a, in which case the result is computed exactly before
+	 *	it's checked.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam Ts
+	 *		The types of \em ts, each of which may be an integer
+	 *		or a safe integer.
+	 *
+	 *	\param [in] a
+	 *		The first factor.
+	 *	\param [in] ts
+	 *		The remaining factors.
+	 *
+	 *	\return
+	 *		A safe integer which has the overflow policy of the
+	 *		first safe integer among the operands (Safe::Throw if
+	 *		there isn't one).
+	 */
+	template <typename A, typename... Ts>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,Ts...>::Type> Product (A a, Ts... ts) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A,Ts...>::Type policy;
+		
+		return ProductOf<policy>(Unwrapped<A>::Get(a),MixedOperand<type,policy>(Unwrapped<Ts>::Get(ts))...);
+	
+	}
+	
+	
+	/**
+	 *	Describes how the quotient of a division which has a
+	 *	remainder is rounded: Toward zero (as built in division
+	 *	does), toward negative infinity, toward positive infinity,
+	 *	or to the nearest integer (with halves rounded away from
+	 *	zero).
+	 */
+	enum class Rounding {
+	
+		Truncate,
+		Floor,
+		Ceiling,
+		Nearest
+	
+	};
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	//	Determines whether the magnitude of the remainder m
+	//	is at least half the magnitude of the divisor c
+	template <bool Signed, typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<Signed,bool>::type HalfOrMore (T m, T c) noexcept {
+	
+		//	Negative magnitudes are compared since the negative
+		//	range of two's complement integers is larger, so
+		//	that none of this can overflow
+		T nm=(m>0) ? static_cast<T>(-m) : m;
+		T nc=(c>0) ? static_cast<T>(-c) : c;
+		
+		return static_cast<T>(nc-nm)>=nm;
+	
+	}
+	
+	
+	template <bool Signed, typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<!Signed,bool>::type HalfOrMore (T m, T c) noexcept {
+	
+		return m>=static_cast<T>(c-m);
+	
+	}
+	
+	
+	//	Rounds the truncated quotient q given the remainder m
+	//	and divisor c, which cannot overflow since the quotient
+	//	of a division with a remainder is always smaller in
+	//	magnitude than the dividend
+	template <Rounding R, bool Signed, typename T>
+	SAFE_CONSTEXPR14 T Round (T q, T m, T c) noexcept {
+	
+		if (m==0) return q;
+		
+		//	The remainder has the sign of the dividend, so this
+		//	is the sign of the exact quotient
+		bool negative=Signed && ((m<0)!=(c<0));
+		switch (R) {
+		
+			case Rounding::Floor:
+				return negative ? static_cast<T>(q-1) : q;
+			case Rounding::Ceiling:
+				return negative ? q : static_cast<T>(q+1);
+			case Rounding::Nearest:
+				if (!HalfOrMore<Signed>(m,c)) return q;
+				return negative ? static_cast<T>(q-1) : static_cast<T>(q+1);
+			default:
+				break;
+		
+		}
+		
+		return q;
+	
+	}
+	
+	
+	//	Multiplies a and b and divides the product by c,
+	//	storing the rounded result in r and returning true if
+	//	it could not be represented by T (in which case r holds
+	//	the result wrapped modulo 2^N, and d the direction in
+	//	which it went out of range)
+	//
+	//	When there's an integer type twice as wide as T the
+	//	product cannot overflow in that type, so only the final
+	//	result is range checked
+	template <Rounding R, typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<Wider<T>::Exists,bool>::type MultiplyDivideOverflows (T a, T b, T c, T & r, Direction & d) noexcept {
+	
+		typedef typename Wider<T>::Type type;
+		
+		//	The quotient of division by zero goes out of range in
+		//	the direction of the sign of the dividend, unless the
+		//	dividend is also zero
+		r=0;
+		d=((a==0) || (b==0)) ? Direction::Undefined : ((IsNegative(a)!=IsNegative(b)) ? Direction::Below : Direction::Above);
+		if (c==0) return true;
+		
+		auto p=static_cast<type>(static_cast<type>(a)*static_cast<type>(b));
+		auto q=Round<R,std::is_signed<T>::value>(static_cast<type>(p/static_cast<type>(c)),static_cast<type>(p%static_cast<type>(c)),static_cast<type>(c));
+		r=static_cast<T>(q);
+		d=(q<0) ? Direction::Below : Direction::Above;
+		
+		return (q>static_cast<type>(std::numeric_limits<T>::max())) || (std::is_signed<T>::value && (q<static_cast<type>(std::numeric_limits<T>::min())));
+	
+	}
+	
+	
+	//	Otherwise the product must also be representable
+	template <Rounding R, typename T>
+	SAFE_CONSTEXPR14 typename std::enable_if<!Wider<T>::Exists,bool>::type MultiplyDivideOverflows (T a, T b, T c, T & r, Direction & d) noexcept {
+	
+		r=0;
+		d=((a==0) || (b==0)) ? Direction::Undefined : ((IsNegative(a)!=IsNegative(b)) ? Direction::Below : Direction::Above);
+		if (c==0) return true;
+		
+		T p=0;
+		bool overflowed=MultiplyOverflows(a,b,p);
+		d=((IsNegative(a)!=IsNegative(b))!=IsNegative(c)) ? Direction::Below : Direction::Above;
+		//	The only other way to overflow is dividing the
+		//	smallest value by negative one, the result of which
+		//	wraps to itself
+		r=p;
+		if (DivideOverflows(p,c)) return true;
+		
+		r=Round<R,std::is_signed<T>::value>(static_cast<T>(p/c),static_cast<T>(p%c),c);
+		
+		return overflowed;
+	
+	}
+	
+	
+	//	Determines whether a quotient, the exact value of which
+	//	is negative or not, is rounded away from zero when
+	//	dividing by a divisor of magnitude c leaves a remainder
+	//	of magnitude m
+	template <Rounding R>
+	constexpr bool RoundsAway (bool negative, std::uintmax_t m, std::uintmax_t c) noexcept {
+	
+		return (m!=0) && (
+			((R==Rounding::Floor) && negative) ||
+			((R==Rounding::Ceiling) && !negative) ||
+			((R==Rounding::Nearest) && (m>=(c-m)))
+		);
+	
+	}
+	
+	
+	//	Multiplies a and b and divides the product by c exactly,
+	//	for when b or c is out of range of T
+	template <Rounding R, typename Policy, typename T, typename B, typename C>
+	SAFE_CONSTEXPR14 T MixedMultiplyDivide (T a, B b, C c) {
+	
+		bool negative=IsNegative(a)!=IsNegative(b);
+		std::uintmax_t h=0;
+		std::uintmax_t l=0;
+		WideMultiply(Magnitude(a),Magnitude(b),h,l);
+		//	The quotient of division by zero goes out of range in
+		//	the direction of the sign of the product, unless the
+		//	product is also zero
+		if (SAFE_UNLIKELY(c==0)) return Policy::Overflow(T(0),((h==0) && (l==0)) ? Direction::Undefined : (negative ? Direction::Below : Direction::Above),Operation::MultiplyDivide,a,b,c);
+		
+		negative=negative!=IsNegative(c);
+		std::uintmax_t m=WideDivide(h,l,Magnitude(c));
+		if (RoundsAway<R>(negative,m,Magnitude(c)) && (++l==0)) ++h;
+		T r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(MagnitudeOverflows(negative,l,h!=0,r,d))) return Policy::Overflow(r,d,Operation::MultiplyDivide,a,b,c);
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Multiplies \em a and \em b and divides the product by
+	 *	\em c, checking only whether the result is in range.
+	 *
+	 *	The product need not be representable, so long as the
+	 *	result is, except for 64 bit integers when there's no 128
+	 *	bit integer type.
+	 *
+	 *	\em b and \em c need not be representable by the integer
+	 *	type of \em a, in which case the result is computed
+	 *	exactly before it's checked.
+	 *
+	 *	\tparam R
+	 *		How the quotient is rounded.  Defaults to
+	 *		Rounding::Truncate, as built in division does.
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam C
+	 *		The type of \em c, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The multiplicand.
+	 *	\param [in] b
+	 *		The multiplier.
+	 *	\param [in] c
+	 *		The divisor.
+	 *
+	 *	\return
+	 *		A safe integer which has the overflow policy of the
+	 *		first safe integer among the operands (Safe::Throw if
+	 *		there isn't one).
+	 */
+	template <Rounding R=Rounding::Truncate, typename A, typename B, typename C>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B,C>::Type> MulDiv (A a, B b, C c) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A,B,C>::Type policy;
+		
+		type x=Unwrapped<A>::Get(a);
+		auto y=MixedOperand<type,policy>(Unwrapped<B>::Get(b));
+		auto z=MixedOperand<type,policy>(Unwrapped<C>::Get(c));
+		if (SAFE_UNLIKELY(!InRange<type>(y) || !InRange<type>(z))) return MixedMultiplyDivide<R,policy>(x,y,z);
+		
+		type r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(MultiplyDivideOverflows<R>(x,static_cast<type>(y),static_cast<type>(z),r,d))) return policy::Overflow(r,d,Operation::MultiplyDivide,x,y,z);
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	template <std::size_t... Is>
+	class Indices {	};
+	
+	
+	template <std::size_t N, std::size_t... Is>
+	class MakeIndices : public MakeIndices<N-1,N-1,Is...> {	};
+	
+	
+	template <std::size_t... Is>
+	class MakeIndices<0,Is...> {
+	
+	
+		public:
+		
+		
+			typedef Indices<Is...> Type;
+	
+	
+	};
+	
+	
+	//	Determines whether base^e is at most limit
+	template <typename T>
+	constexpr bool PowerAtMost (T base, std::size_t e, T limit) noexcept {
+	
+		return (e==0) || (base==0) || ((base<=limit) && PowerAtMost(base,e-1,static_cast<T>(limit/base)));
+	
+	}
+	
+	
+	//	Finds the largest integer which is at most limit when
+	//	raised to the power of e by binary search between lo,
+	//	which is, and hi
+	template <typename T>
+	constexpr T Root (T limit, std::size_t e, T lo, T hi) noexcept {
+	
+		return (lo==hi) ? lo : (
+			PowerAtMost(static_cast<T>(lo+((hi-lo)/2)+((hi-lo)%2)),e,limit)
+				?	Root(limit,e,static_cast<T>(lo+((hi-lo)/2)+((hi-lo)%2)),hi)
+				:	Root(limit,e,lo,static_cast<T>(lo+((hi-lo)/2)+((hi-lo)%2)-1))
+		);
+	
+	}
+	
+	
+	template <typename T>
+	constexpr T Root (T limit, std::size_t e) noexcept {
+	
+		return (e==0) ? std::numeric_limits<T>::max() : Root(limit,e,T(1),limit);
+	
+	}
+	
+	
+	//	For each exponent up to the width of T, the largest
+	//	magnitude which may be raised to that power without
+	//	the result going above (Above) or below (Below) the
+	//	range of T
+	//
+	//	Beyond the width of T only magnitudes of zero and one
+	//	may be raised to the power
+	template <typename T, typename=typename MakeIndices<std::numeric_limits<T>::digits+2>::Type>
+	class PowerBounds;
+	
+	
+	template <typename T, std::size_t... Is>
+	class PowerBounds<T,Indices<Is...>> {
+	
+	
+		public:
+		
+		
+			typedef typename std::make_unsigned<T>::type Type;
+			
+			
+			static constexpr std::size_t Size=sizeof...(Is);
+			static constexpr Type Above [sizeof...(Is)]={Root(static_cast<Type>(std::numeric_limits<T>::max()),Is)...};
+			static constexpr Type Below [sizeof...(Is)]={Root(static_cast<Type>(static_cast<Type>(std::numeric_limits<T>::max())+(std::is_signed<T>::value ? 1U : 0U)),Is)...};
+	
+	
+	};
+	
+	
+	template <typename T, std::size_t... Is>
+	constexpr typename PowerBounds<T,Indices<Is...>>::Type PowerBounds<T,Indices<Is...>>::Above [sizeof...(Is)];
+	template <typename T, std::size_t... Is>
+	constexpr typename PowerBounds<T,Indices<Is...>>::Type PowerBounds<T,Indices<Is...>>::Below [sizeof...(Is)];
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Raises \em base to the power of \em exponent.
+	 *
+	 *	Whether the result is in range is determined by comparing
+	 *	the magnitude of \em base against a bound for \em exponent
+	 *	computed at compile time, after which the result is
+	 *	computed by squaring without any further checks.
+	 *
+	 *	\tparam A
+	 *		The type of \em base, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] base
+	 *		The base.
+	 *	\param [in] exponent
+	 *		The exponent.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type and overflow
+	 *		policy of \em base (Safe::Throw if it's not a safe
+	 *		integer).
+	 */
+	template <typename A>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A>::Type> Pow (A base, unsigned int exponent) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A>::Type policy;
+		typedef PowerBounds<type> bounds;
+		typedef typename bounds::Type unsigned_type;
+		//	At least as wide as unsigned int, so that multiplying
+		//	narrow types doesn't promote to int and overflow
+		typedef typename std::common_type<unsigned_type,unsigned int>::type wide_type;
+		
+		type b=Unwrapped<A>::Get(base);
+		bool negative=IsNegative(b) && ((exponent%2)!=0);
+		auto magnitude=IsNegative(b) ? static_cast<unsigned_type>(unsigned_type(0)-static_cast<unsigned_type>(b)) : static_cast<unsigned_type>(b);
+		bool overflowed=(exponent<bounds::Size) ? (magnitude>(negative ? bounds::Below[exponent] : bounds::Above[exponent])) : (magnitude>1);
+		
+		//	Squaring wraps, so this is also the wrapped result
+		//	if it's out of range
+		unsigned_type r=1;
+		for (auto e=exponent;e!=0;e/=2) {
+		
+			if ((e%2)!=0) r=static_cast<unsigned_type>(static_cast<wide_type>(r)*static_cast<wide_type>(magnitude));
+			magnitude=static_cast<unsigned_type>(static_cast<wide_type>(magnitude)*static_cast<wide_type>(magnitude));
+		
+		}
+		auto result=static_cast<type>(negative ? static_cast<unsigned_type>(unsigned_type(0)-r) : r);
+		if (SAFE_UNLIKELY(overflowed)) return policy::Overflow(result,negative ? Direction::Below : Direction::Above,Operation::Power,b,exponent);
+		
+		return result;
+	
+	}
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	//	Counts the leading zero bits of x, which must be unsigned
+	//	and not zero
+	#ifdef SAFE_BUILTINS
+	template <typename T>
+	constexpr typename std::enable_if<(std::numeric_limits<T>::digits<=std::numeric_limits<unsigned long long>::digits),int>::type LeadingZeros (T x) noexcept {
+	
+		return __builtin_clzll(x)-(std::numeric_limits<unsigned long long>::digits-std::numeric_limits<T>::digits);
+	
+	}
+	
+	
+	template <typename T>
+	constexpr typename std::enable_if<(std::numeric_limits<T>::digits<=std::numeric_limits<unsigned long long>::digits),int>::type PopulationCount (T x) noexcept {
+	
+		return __builtin_popcountll(x);
+	
+	}
+	
+	
+	//	The builtins take unsigned long long, so wider integers
+	//	(i.e. 128 bit integers) are split into a high and a low
+	//	half
+	template <typename T>
+	constexpr typename std::enable_if<(std::numeric_limits<T>::digits>std::numeric_limits<unsigned long long>::digits),int>::type LeadingZeros (T x) noexcept {
+	
+		static_assert(std::numeric_limits<T>::digits<=(std::numeric_limits<unsigned long long>::digits*2),"Integer is too wide");
+		
+		return (static_cast<unsigned long long>(x>>std::numeric_limits<unsigned long long>::digits)==0)
+			?	((std::numeric_limits<T>::digits-std::numeric_limits<unsigned long long>::digits)+LeadingZeros(static_cast<unsigned long long>(x)))
+			:	(LeadingZeros(static_cast<unsigned long long>(x>>std::numeric_limits<unsigned long long>::digits))-((std::numeric_limits<unsigned long long>::digits*2)-std::numeric_limits<T>::digits));
+	
+	}
+	
+	
+	template <typename T>
+	constexpr typename std::enable_if<(std::numeric_limits<T>::digits>std::numeric_limits<unsigned long long>::digits),int>::type PopulationCount (T x) noexcept {
+	
+		return PopulationCount(static_cast<unsigned long long>(x>>std::numeric_limits<unsigned long long>::digits))+PopulationCount(static_cast<unsigned long long>(x));
+	
+	}
+	#else
+	//	Binary search for the highest set bit
+	template <typename T>
+	SAFE_CONSTEXPR14 int LeadingZeros (T x) noexcept {
+	
+		int n=0;
+		for (int shift=std::numeric_limits<T>::digits/2;shift!=0;shift/=2) if ((x>>(std::numeric_limits<T>::digits-shift))==0) {
+		
+			n+=shift;
+			x=static_cast<T>(x<<shift);
+		
+		}
+		
+		return n;
+	
+	}
+	
+	
+	//	Each iteration clears the lowest set bit
+	template <typename T>
+	SAFE_CONSTEXPR14 int PopulationCount (T x) noexcept {
+	
+		int n=0;
+		for (;x!=0;++n) x=static_cast<T>(x&(x-1));
+		
+		return n;
+	
+	}
+	#endif
+	
+	
+	template <typename T>
+	SAFE_CONSTEXPR14 int UsedBits (T x) noexcept {
+	
+		return (x==0) ? 0 : (std::numeric_limits<T>::digits-LeadingZeros(x));
+	
+	}
+	
+	
+	template <typename T>
+	constexpr T PowerOf10 (std::size_t n) noexcept {
+	
+		return (n==0) ? T(1) : static_cast<T>(PowerOf10<T>(n-1)*10);
+	
+	}
+	
+	
+	//	Every power of ten which the unsigned integer type T can
+	//	represent
+	template <typename T, typename=typename MakeIndices<std::numeric_limits<T>::digits10+1>::Type>
+	class PowersOf10;
+	
+	
+	template <typename T, std::size_t... Is>
+	class PowersOf10<T,Indices<Is...>> {
+	
+	
+		public:
+		
+		
+			static constexpr T Values []={PowerOf10<T>(Is)...};
+	
+	
+	};
+	
+	
+	template <typename T, std::size_t... Is>
+	constexpr T PowersOf10<T,Indices<Is...>>::Values [];
+	
+	
+	//	Reports an argument for which the result is undefined
+	//	(i.e. a negative number) the same way as division by
+	//	zero
+	template <typename Policy, typename T>
+	SAFE_CONSTEXPR14 T DomainError (Operation op, T x) {
+	
+		return Policy::Overflow(T(0),Direction::Undefined,op,x);
+	
+	}
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Finds the square root of an integer, rounded down.
+	 *
+	 *	The root is found exactly, one bit at a time, without
+	 *	converting to floating point.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer, which must not be negative.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type and overflow
+	 *		policy of \em a (Safe::Throw if it's not a safe
+	 *		integer).
+	 */
+	template <typename A>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A>::Type> ISqrt (A a) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename std::make_unsigned<type>::type unsigned_type;
+		
+		type x=Unwrapped<A>::Get(a);
+		if (SAFE_UNLIKELY(IsNegative(x))) return DomainError<typename FirstPolicy<A>::Type>(Operation::SquareRoot,x);
+		if (x==0) return x;
+		
+		//	Starting from the largest power of four which is
+		//	at most x, each bit of the root is set if the square
+		//	of the root so far with that bit set is at most x
+		auto remainder=static_cast<unsigned_type>(x);
+		unsigned_type root=0;
+		for (auto bit=static_cast<unsigned_type>(unsigned_type(1)<<((UsedBits(remainder)-1)&~1));bit!=0;bit=static_cast<unsigned_type>(bit>>2)) {
+		
+			auto trial=static_cast<unsigned_type>(root+bit);
+			root=static_cast<unsigned_type>(root>>1);
+			if (remainder>=trial) {
+			
+				remainder=static_cast<unsigned_type>(remainder-trial);
+				root=static_cast<unsigned_type>(root+bit);
+			
+			}
+		
+		}
+		
+		return static_cast<type>(root);
+	
+	}
+	
+	
+	/**
+	 *	Finds the base two logarithm of an integer, rounded down.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer, which must be positive.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type and overflow
+	 *		policy of \em a (Safe::Throw if it's not a safe
+	 *		integer).
+	 */
+	template <typename A>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A>::Type> ILog2 (A a) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename std::make_unsigned<type>::type unsigned_type;
+		
+		type x=Unwrapped<A>::Get(a);
+		if (SAFE_UNLIKELY((x==0) || IsNegative(x))) return DomainError<typename FirstPolicy<A>::Type>(Operation::Logarithm,x);
+		
+		return static_cast<type>(UsedBits(static_cast<unsigned_type>(x))-1);
+	
+	}
+	
+	
+	/**
+	 *	Finds the base ten logarithm of an integer, rounded down.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer, which must be positive.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type and overflow
+	 *		policy of \em a (Safe::Throw if it's not a safe
+	 *		integer).
+	 */
+	template <typename A>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A>::Type> ILog10 (A a) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename std::make_unsigned<type>::type unsigned_type;
+		
+		type x=Unwrapped<A>::Get(a);
+		if (SAFE_UNLIKELY((x==0) || IsNegative(x))) return DomainError<typename FirstPolicy<A>::Type>(Operation::Logarithm,x);
+		
+		//	1233/4096 is slightly more than the base ten logarithm
+		//	of two, so this is either the logarithm or one more
+		//	than it
+		auto log=(UsedBits(static_cast<unsigned_type>(x))*1233)>>12;
+		
+		return static_cast<type>(log-((static_cast<unsigned_type>(x)<PowersOf10<unsigned_type>::Values[log]) ? 1 : 0));
+	
+	}
+	
+	
+	/**
+	 *	Finds the number of bits needed to represent an integer
+	 *	(i.e. one more than the base two logarithm, or zero for
+	 *	zero).
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer, which must not be negative.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type and overflow
+	 *		policy of \em a (Safe::Throw if it's not a safe
+	 *		integer).
+	 */
+	template <typename A>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A>::Type> BitWidth (A a) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename std::make_unsigned<type>::type unsigned_type;
+		
+		type x=Unwrapped<A>::Get(a);
+		if (SAFE_UNLIKELY(IsNegative(x))) return DomainError<typename FirstPolicy<A>::Type>(Operation::BitCount,x);
+		
+		return static_cast<type>(UsedBits(static_cast<unsigned_type>(x)));
+	
+	}
+	
+	
+	/**
+	 *	Counts the bits of an integer which are set.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer, which must not be negative.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type and overflow
+	 *		policy of \em a (Safe::Throw if it's not a safe
+	 *		integer).
+	 */
+	template <typename A>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A>::Type> PopCount (A a) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename std::make_unsigned<type>::type unsigned_type;
+		
+		type x=Unwrapped<A>::Get(a);
+		if (SAFE_UNLIKELY(IsNegative(x))) return DomainError<typename FirstPolicy<A>::Type>(Operation::BitCount,x);
+		
+		return static_cast<type>(PopulationCount(static_cast<unsigned_type>(x)));
+	
+	}
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	template <typename A, typename B>
+	class Span {
+	
+	
+		public:
+		
+		
+			//	The unsigned type of the same width as the wider
+			//	of A and B
+			typedef typename std::make_unsigned<
+				typename std::conditional<(sizeof(A)>=sizeof(B)),A,B>::type
+			>::type Type;
+			
+			
+			//	Computes the magnitude of b-a (modulo 2^N) and
+			//	whether b is less than a, returning true if the
+			//	magnitude cannot be represented by Type
+			//
+			//	This is only possible when one of A and B is signed
+			//	and the other is not, the lesser is negative, and
+			//	subtracting the lesser from the greater as unsigned
+			//	integers doesn't borrow
+			SAFE_CONSTEXPR14 static bool Get (A a, B b, Type & magnitude, bool & negative) noexcept {
+			
+				negative=Compare(a,b)>0;
+				auto x=static_cast<Type>(a);
+				auto y=static_cast<Type>(b);
+				magnitude=static_cast<Type>(negative ? (x-y) : (y-x));
+				
+				return (std::is_signed<A>::value!=std::is_signed<B>::value) && (IsNegative(a)!=IsNegative(b)) && (negative ? (x>=y) : (y>=x));
+			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Finds the integer midway between two integers, rounding
+	 *	toward \em a.
+	 *
+	 *	Unlike (a+b)/2 this never overflows when \em a and
+	 *	\em b have the same type.  Otherwise the midpoint is
+	 *	found exactly (as comparisons between integers of
+	 *	different signedness are), and only whether it's in
+	 *	range of the integer type of \em a is checked, with a
+	 *	single comparison.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer toward which the midpoint is rounded.
+	 *	\param [in] b
+	 *		The other integer.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type of \em a
+	 *		and the overflow policy of the first safe integer
+	 *		among the operands (Safe::Throw if there isn't one).
+	 */
+	template <typename A, typename B>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B>::Type> Midpoint (A a, B b) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename Unwrapped<B>::Type other_type;
+		typedef typename Span<type,other_type>::Type unsigned_type;
+		
+		type x=Unwrapped<A>::Get(a);
+		other_type y=Unwrapped<B>::Get(b);
+		unsigned_type magnitude=0;
+		bool negative=false;
+		bool carry=Span<type,other_type>::Get(x,y,magnitude,negative);
+		//	Halving the magnitude makes room for the bit which
+		//	didn't fit
+		auto half=static_cast<unsigned_type>((magnitude>>1)|(static_cast<unsigned_type>(carry)<<(std::numeric_limits<unsigned_type>::digits-1)));
+		auto r=static_cast<type>(negative ? static_cast<unsigned_type>(static_cast<unsigned_type>(x)-half) : static_cast<unsigned_type>(static_cast<unsigned_type>(x)+half));
+		//	If every value of B is a value of A the midpoint is
+		//	too, otherwise it's in range if and only if half is
+		//	no greater than the distance from a to the bound of
+		//	A in the direction of b
+		if (!(InRange<type>(std::numeric_limits<other_type>::min()) && InRange<type>(std::numeric_limits<other_type>::max()))) {
+		
+			auto limit=negative
+				?	static_cast<unsigned_type>(static_cast<unsigned_type>(x)-static_cast<unsigned_type>(std::numeric_limits<type>::min()))
+				:	static_cast<unsigned_type>(static_cast<unsigned_type>(std::numeric_limits<type>::max())-static_cast<unsigned_type>(x));
+			if (SAFE_UNLIKELY(half>limit)) return FirstPolicy<A,B>::Type::Overflow(r,negative ? Direction::Below : Direction::Above,Operation::Midpoint,x,y);
+		
+		}
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	Finds the magnitude of the difference between two
+	 *	integers.
+	 *
+	 *	This never overflows when \em a and \em b have the
+	 *	same signedness.  Otherwise the difference is found
+	 *	exactly (as comparisons between integers of different
+	 *	signedness are), and only whether it's in range of the
+	 *	result is checked.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The first integer.
+	 *	\param [in] b
+	 *		The second integer.
+	 *
+	 *	\return
+	 *		A safe integer which has the unsigned integer type
+	 *		of the same width as the wider of \em a and \em b,
+	 *		and the overflow policy of the first safe integer
+	 *		among the operands (Safe::Throw if there isn't one).
+	 */
+	template <typename A, typename B>
+	SAFE_CONSTEXPR14 Integer<
+		typename Span<typename Unwrapped<A>::Type,typename Unwrapped<B>::Type>::Type,
+		typename FirstPolicy<A,B>::Type
+	> AbsDiff (A a, B b) {
+	
+		typedef Span<typename Unwrapped<A>::Type,typename Unwrapped<B>::Type> span;
+		
+		auto x=Unwrapped<A>::Get(a);
+		auto y=Unwrapped<B>::Get(b);
+		typename span::Type magnitude=0;
+		bool negative=false;
+		if (SAFE_UNLIKELY(span::Get(x,y,magnitude,negative))) return FirstPolicy<A,B>::Type::Overflow(magnitude,Direction::Above,Operation::Difference,x,y);
+		
+		return magnitude;
+	
+	}
+	
+	
+	/**
+	 *	Finds the signed distance from one integer to another,
+	 *	i.e. \em b minus \em a.
+	 *
+	 *	The difference is found exactly (as comparisons between
+	 *	integers of different signedness are), and when \em a
+	 *	and \em b have the same signedness whether it's in
+	 *	range of the result is checked with a single comparison.
+	 *	For example the distance between two Safe::SizeType
+	 *	values is a Safe::PointerDifferenceType.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer from which the distance is measured.
+	 *	\param [in] b
+	 *		The integer to which the distance is measured.
+	 *
+	 *	\return
+	 *		A safe integer which has the signed integer type
+	 *		of the same width as the wider of \em a and \em b,
+	 *		and the overflow policy of the first safe integer
+	 *		among the operands (Safe::Throw if there isn't one).
+	 */
+	template <typename A, typename B>
+	SAFE_CONSTEXPR14 Integer<
+		typename std::make_signed<typename Span<typename Unwrapped<A>::Type,typename Unwrapped<B>::Type>::Type>::type,
+		typename FirstPolicy<A,B>::Type
+	> Distance (A a, B b) {
+	
+		typedef Span<typename Unwrapped<A>::Type,typename Unwrapped<B>::Type> span;
+		typedef typename span::Type unsigned_type;
+		typedef typename std::make_signed<unsigned_type>::type type;
+		
+		auto x=Unwrapped<A>::Get(a);
+		auto y=Unwrapped<B>::Get(b);
+		unsigned_type magnitude=0;
+		bool negative=false;
+		bool overflowed=span::Get(x,y,magnitude,negative);
+		//	The negation of the magnitude is in range if and
+		//	only if one less than the magnitude is no greater
+		//	than the maximum, so that subtracting whether it's
+		//	negative makes this one comparison
+		overflowed|=static_cast<unsigned_type>(magnitude-negative)>static_cast<unsigned_type>(std::numeric_limits<type>::max());
+		auto r=static_cast<type>(negative ? static_cast<unsigned_type>(unsigned_type(0)-magnitude) : magnitude);
+		if (SAFE_UNLIKELY(overflowed)) return FirstPolicy<A,B>::Type::Overflow(r,negative ? Direction::Below : Direction::Above,Operation::Difference,x,y);
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	template <typename T>
+	constexpr bool IsPowerOfTwo (T x) noexcept {
+	
+		return (x>0) && ((x&(x-1))==0);
+	
+	}
+	
+	
+	//	Rounds x up to the next multiple of one more than
+	//	mask, which is one less than a power of two, storing
+	//	the result in r (wrapped modulo 2^N) and returning true
+	//	if it could not be represented by T
+	//
+	//	The largest value which may be rounded up is the
+	//	largest multiple, so this is one comparison
+	template <typename T>
+	SAFE_CONSTEXPR14 bool AlignUpOverflows (T x, T mask, T & r) noexcept {
+	
+		typedef typename std::make_unsigned<T>::type type;
+		
+		auto m=static_cast<type>(~static_cast<type>(mask));
+		r=static_cast<T>(static_cast<type>(static_cast<type>(x)+static_cast<type>(mask))&m);
+		
+		return x>static_cast<T>(static_cast<type>(std::numeric_limits<T>::max())&m);
+	
+	}
+	
+	
+	//	Divides x by y rounding as specified, which may only
+	//	overflow when dividing by zero or the smallest value by
+	//	negative one
+	//
+	//	Dividing by a power of two is a shift, and rounding
+	//	up adds whether any bits were shifted out, so that
+	//	doesn't overflow either
+	template <Rounding R, typename Policy, typename T>
+	SAFE_CONSTEXPR14 T RoundedDivide (T x, T y) {
+	
+		typedef typename std::make_unsigned<T>::type type;
+		
+		//	The quotient of division by zero goes out of range in
+		//	the direction of the sign of the dividend, unless the
+		//	dividend is also zero
+		if (SAFE_UNLIKELY(DivideOverflows(x,y))) return Policy::Overflow(
+			(y==0) ? T(0) : x,
+			((y==0) && (x==0)) ? Direction::Undefined : (((y==0) && IsNegative(x)) ? Direction::Below : Direction::Above),
+			Operation::Divide,
+			x,
+			y
+		);
+		
+		if (IsPowerOfTwo(y)) {
+		
+			int shift=UsedBits(static_cast<type>(y))-1;
+			//	Negative numbers aren't shifted, since ~x is
+			//	-x-1 the floor of its quotient is too
+			auto q=IsNegative(x) ? static_cast<T>(~static_cast<T>(static_cast<T>(~x)>>shift)) : static_cast<T>(x>>shift);
+			if (R==Rounding::Ceiling) return static_cast<T>(q+(((x&static_cast<T>(y-1))==0) ? 0 : 1));
+			
+			return q;
+		
+		}
+		
+		return Round<R,std::is_signed<T>::value>(static_cast<T>(x/y),static_cast<T>(x%y),y);
+	
+	}
+	
+	
+	//	As above, except that y may be of any type
+	//
+	//	When y is out of range of T (and therefore not zero)
+	//	the quotient is computed on magnitudes, so that y isn't
+	//	converted to T
+	template <Rounding R, typename Policy, typename T, typename U>
+	SAFE_CONSTEXPR14 T MixedRoundedDivide (T x, U y) {
+	
+		if (InRange<T>(y)) return RoundedDivide<R,Policy>(x,static_cast<T>(y));
+		
+		bool negative=IsNegative(x)!=IsNegative(y);
+		auto m=Magnitude(y);
+		auto q=static_cast<std::uintmax_t>(Magnitude(x)/m);
+		if (RoundsAway<R>(negative,static_cast<std::uintmax_t>(Magnitude(x)%m),m)) ++q;
+		T r=0;
+		Direction d=Direction::Above;
+		if (SAFE_UNLIKELY(MagnitudeOverflows(negative,q,false,r,d))) return Policy::Overflow(r,d,Operation::Divide,x,y);
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Rounds an integer up to the next multiple of a power
+	 *	of two.
+	 *
+	 *	Unlike (a+alignment-1)&~(alignment-1) this checks
+	 *	whether the result is in range, with a single
+	 *	comparison against the largest multiple of the
+	 *	alignment.  For example rounding a Safe::SizeType up to
+	 *	the alignment of a type never silently wraps to zero.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em alignment, which may be an integer
+	 *		or a safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer to round up.
+	 *	\param [in] alignment
+	 *		The alignment, which must be a positive power of
+	 *		two representable by the integer type of \em a.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type of \em a
+	 *		and the overflow policy of the first safe integer
+	 *		among the operands (Safe::Throw if there isn't one).
+	 */
+	template <typename A, typename B>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B>::Type> AlignUp (A a, B alignment) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A,B>::Type policy;
+		
+		type x=Unwrapped<A>::Get(a);
+		auto align=MixedOperand<type,policy>(Unwrapped<B>::Get(alignment));
+		if (SAFE_UNLIKELY(!InRange<type>(align) || !IsPowerOfTwo(align))) return policy::Overflow(type(0),Direction::Undefined,Operation::Align,x,align);
+		
+		auto y=static_cast<type>(align);
+		type r=0;
+		if (SAFE_UNLIKELY(AlignUpOverflows(x,static_cast<type>(y-1),r))) return policy::Overflow(r,Direction::Above,Operation::Align,x,y);
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	Rounds an integer down to the previous multiple of a
+	 *	power of two.
+	 *
+	 *	This never overflows, negative integers are rounded
+	 *	toward negative infinity.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em alignment, which may be an integer
+	 *		or a safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer to round down.
+	 *	\param [in] alignment
+	 *		The alignment, which must be a positive power of
+	 *		two representable by the integer type of \em a.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type of \em a
+	 *		and the overflow policy of the first safe integer
+	 *		among the operands (Safe::Throw if there isn't one).
+	 */
+	template <typename A, typename B>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B>::Type> AlignDown (A a, B alignment) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename std::make_unsigned<type>::type unsigned_type;
+		typedef typename FirstPolicy<A,B>::Type policy;
+		
+		type x=Unwrapped<A>::Get(a);
+		auto align=MixedOperand<type,policy>(Unwrapped<B>::Get(alignment));
+		if (SAFE_UNLIKELY(!InRange<type>(align) || !IsPowerOfTwo(align))) return policy::Overflow(type(0),Direction::Undefined,Operation::Align,x,align);
+		
+		auto y=static_cast<type>(align);
+		
+		return static_cast<type>(static_cast<unsigned_type>(x)&static_cast<unsigned_type>(~static_cast<unsigned_type>(y-1)));
+	
+	}
+	
+	
+	/**
+	 *	Divides one integer by another, rounding the quotient
+	 *	toward negative infinity.
+	 *
+	 *	When the divisor is a power of two this is a shift
+	 *	rather than a division.  Only dividing by zero or the
+	 *	smallest value by negative one overflows, unless the
+	 *	divisor isn't representable by the integer type of
+	 *	\em a, in which case the quotient is computed exactly
+	 *	before it's checked.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The dividend.
+	 *	\param [in] b
+	 *		The divisor.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type of \em a
+	 *		and the overflow policy of the first safe integer
+	 *		among the operands (Safe::Throw if there isn't one).
+	 */
+	template <typename A, typename B>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B>::Type> DivFloor (A a, B b) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A,B>::Type policy;
+		
+		return MixedRoundedDivide<Rounding::Floor,policy>(Unwrapped<A>::Get(a),MixedOperand<type,policy>(Unwrapped<B>::Get(b)));
+	
+	}
+	
+	
+	/**
+	 *	Divides one integer by another, rounding the quotient
+	 *	toward positive infinity.
+	 *
+	 *	Unlike (a+b-1)/b this cannot overflow when \em a is
+	 *	near the top of the range.  When the divisor is a power
+	 *	of two this is a shift rather than a division.  Only
+	 *	dividing by zero or the smallest value by negative one
+	 *	overflows, unless the divisor isn't representable by the
+	 *	integer type of \em a, in which case the quotient is
+	 *	computed exactly before it's checked.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The dividend.
+	 *	\param [in] b
+	 *		The divisor.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type of \em a
+	 *		and the overflow policy of the first safe integer
+	 *		among the operands (Safe::Throw if there isn't one).
+	 */
+	template <typename A, typename B>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B>::Type> DivCeil (A a, B b) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A,B>::Type policy;
+		
+		return MixedRoundedDivide<Rounding::Ceiling,policy>(Unwrapped<A>::Get(a),MixedOperand<type,policy>(Unwrapped<B>::Get(b)));
+	
+	}
+	
+	
+	/**
+	 *	Rounds an integer up to the next multiple of another.
+	 *
+	 *	Unlike (a+b-1)/b*b this only checks whether the result
+	 *	is in range, once.  When the multiple is a power of two
+	 *	this is the same as Safe::AlignUp, and doesn't divide.
+	 *
+	 *	\tparam A
+	 *		The type of \em a, which may be an integer or a
+	 *		safe integer.
+	 *	\tparam B
+	 *		The type of \em b, which may be an integer or a
+	 *		safe integer.
+	 *
+	 *	\param [in] a
+	 *		The integer to round up.
+	 *	\param [in] b
+	 *		The multiple, which must be positive and
+	 *		representable by the integer type of \em a.
+	 *
+	 *	\return
+	 *		A safe integer which has the integer type of \em a
+	 *		and the overflow policy of the first safe integer
+	 *		among the operands (Safe::Throw if there isn't one).
+	 */
+	template <typename A, typename B>
+	SAFE_CONSTEXPR14 Integer<typename Unwrapped<A>::Type,typename FirstPolicy<A,B>::Type> RoundUpToMultiple (A a, B b) {
+	
+		typedef typename Unwrapped<A>::Type type;
+		typedef typename FirstPolicy<A,B>::Type policy;
+		
+		type x=Unwrapped<A>::Get(a);
+		auto multiple=MixedOperand<type,policy>(Unwrapped<B>::Get(b));
+		if (SAFE_UNLIKELY(!InRange<type>(multiple) || (multiple==0) || IsNegative(multiple))) return policy::Overflow(type(0),Direction::Undefined,Operation::RoundToMultiple,x,multiple);
+		
+		auto y=static_cast<type>(multiple);
+		type r=0;
+		if (IsPowerOfTwo(y)) {
+		
+			if (SAFE_UNLIKELY(AlignUpOverflows(x,static_cast<type>(y-1),r))) return policy::Overflow(r,Direction::Above,Operation::RoundToMultiple,x,y);
+			
+			return r;
+		
+		}
+		
+		//	The remainder has the sign of the dividend, and
+		//	negative integers are rounded up by subtracting it,
+		//	which moves toward zero and so can't overflow
+		auto m=static_cast<type>(x%y);
+		if ((m==0) || IsNegative(m)) return static_cast<type>(x-m);
+		if (SAFE_UNLIKELY(AddOverflows(x,static_cast<type>(y-m),r))) return policy::Overflow(r,Direction::Above,Operation::RoundToMultiple,x,y);
+		
+		return r;
+	
+	}
+	
+	
+	/**
+	 *	An integer which remembers whether any operation which
+	 *	produced it went out of range, rather than checking each
+	 *	operation as it is performed.
+	 *
+	 *	Once an operation goes out of range the result and all
+	 *	results computed from it are marked as having overflowed,
+	 *	much like NaN.  This is only checked when the value is
+	 *	retrieved, which allows long expressions to be evaluated
+	 *	without branching.
+	 *
+	 *	Note that mixing checked integers with safe integers
+	 *	requires that the safe integer be converted explicitly.
+	 *
+	 *	\tparam T
+	 *		The type of integer to wrap.
+	 *	\tparam Policy
+	 *		The overflow policy, which determines what happens
+	 *		when a value which overflowed is retrieved.
+	 */
+	template <typename T, typename Policy=Throw>
+	class Checked {
+	
+	
+		template <typename, typename>
+		friend class Checked;
+		
+		
+		private:
+		
+		
+			T value;
+			bool overflowed;
+			Direction direction;
+			
+			
+			//	Only the direction of the first operation which
+			//	went out of range is kept, since the values
+			//	computed after it are meaningless
+			void overflow (bool o, Direction d) noexcept {
+			
+				if (o && !overflowed) direction=d;
+				overflowed|=o;
+			
+			}
+			
+			
+			//	Once the value has gone out of range its direction
+			//	is only kept by operations which move it further
+			//	that way, since any other operation may bring the
+			//	exact result back into range or past it
+			void follow (bool was, bool above, bool below) noexcept {
+			
+				if (was && ((direction==Direction::Above) ? !above : !below)) direction=Direction::Undefined;
+			
+			}
+			
+			
+			template <typename U>
+			void convert (U u, T & r) noexcept {
+			
+				overflow(ConvertOverflows(u,r),IsNegative(Unwrapped<U>::Get(u)) ? Direction::Below : Direction::Above);
+			
+			}
+			
+			
+			template <typename U, typename P>
+			void convert (Checked<U,P> u, T & r) noexcept {
+			
+				//	Operands which went out of range in different
+				//	directions may cancel out
+				if (u.overflowed && overflowed && (u.direction!=direction)) direction=Direction::Undefined;
+				overflow(u.overflowed,u.direction);
+				overflow(ConvertOverflows(u.value,r),IsNegative(u.value) ? Direction::Below : Direction::Above);
+			
+			}
+		
+		
+		public:
+		
+		
+			static_assert(std::is_integral<T>::value,"Safe::Checked may only wrap integers");
+			
+			
+			typedef T Type;
+			typedef Policy PolicyType;
+			
+			
+			/**
+			 *	Creates a checked integer with the value zero.
+			 */
+			constexpr Checked () noexcept : value(0), overflowed(false), direction(Direction::Undefined) {	}
+			
+			
+			/**
+			 *	Creates a checked integer from an integer or a
+			 *	safe integer, which overflows if it's out of
+			 *	range.
+			 *
+			 *	\tparam U
+			 *		The type of \em i.
+			 *
+			 *	\param [in] i
 			 *		The integer.
+			 */
+			template <typename U>
+			Checked (U i) noexcept : overflowed(false), direction(Direction::Undefined) {
+			
+				convert(i,value);
+			
+			}
+			
+			
+			/**
+			 *	Creates a checked integer from a checked integer
+			 *	of another type, which overflows if the value is
+			 *	out of range or if \em i had overflowed.
+			 *
+			 *	\tparam U
+			 *		The integer type of \em i.
+			 *	\tparam P
+			 *		The overflow policy of \em i.
+			 *
+			 *	\param [in] i
+			 *		The checked integer.
+			 */
+			template <typename U, typename P>
+			Checked (Checked<U,P> i) noexcept : overflowed(false), direction(Direction::Undefined) {
+			
+				convert(i,value);
+			
+			}
+			
+			
+			/**
+			 *	Creates a checked integer from the result of an
+			 *	operation which does not throw, which overflows if
+			 *	the operation went out of range.
+			 *
+			 *	\tparam U
+			 *		The integer type of \em r.
+			 *
+			 *	\param [in] r
+			 *		The result.
+			 */
+			template <typename U>
+			Checked (Result<U> r) noexcept : overflowed(false), direction(Direction::Undefined) {
+			
+				//	The direction in which the operation went out
+				//	of range isn't known
+				overflow(r.Overflowed(),Direction::Undefined);
+				convert(r.Get(),value);
+			
+			}
+			
+			
+			/**
+			 *	Determines whether any operation which produced
+			 *	this value went out of range.
+			 *
+			 *	\return
+			 *		\em true if an operation went out of range,
+			 *		\em false otherwise.
+			 */
+			constexpr bool Overflowed () const noexcept {
+			
+				return overflowed;
+			
+			}
+			
+			
+			/**
+			 *	Retrieves the value, invoking the overflow policy
+			 *	if any operation which produced it went out of
+			 *	range.
+			 *
+			 *	The policy is passed the value wrapped modulo 2^N
+			 *	and the direction in which the first operation
+			 *	which went out of range did so, or
+			 *	Safe::Direction::Undefined if a later operation
+			 *	could have brought the exact result back into
+			 *	range or past it (e.g. multiplying by a negative
+			 *	number).
+			 *
+			 *	\return
+			 *		The value.
+			 */
+			T Get () const noexcept(noexcept(Policy::Overflow(std::declval<T>(),Direction::Undefined,Operation::Expression,std::declval<T>()))) {
+			
+				if (SAFE_UNLIKELY(overflowed)) return Policy::Overflow((direction==Direction::Undefined) ? T(0) : value,direction,Operation::Expression,value);
+				
+				return value;
+			
+			}
+			
+			
+			/**
+			 *	Adds \em b to this checked integer.
+			 *
+			 *	\tparam U
+			 *		The type of \em b, which may be an integer, a
+			 *		safe integer, or a checked integer.
+			 *
+			 *	\param [in] b
+			 *		The right hand side.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			template <typename U>
+			Checked & operator += (U b) noexcept {
+			
+				bool was=overflowed;
+				T c;
+				convert(b,c);
+				follow(was,!IsNegative(c),IsNegative(c) || (c==0));
+				overflow(AddOverflows(value,c,value),IsNegative(c) ? Direction::Below : Direction::Above);
+				
+				return *this;
+			
+			}
+			
+			
+			/**
+			 *	Subtracts \em b from this checked integer.
+			 *
+			 *	\tparam U
+			 *		The type of \em b, which may be an integer, a
+			 *		safe integer, or a checked integer.
+			 *
+			 *	\param [in] b
+			 *		The right hand side.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			template <typename U>
+			Checked & operator -= (U b) noexcept {
+			
+				bool was=overflowed;
+				T c;
+				convert(b,c);
+				follow(was,IsNegative(c) || (c==0),!IsNegative(c));
+				overflow(SubtractOverflows(value,c,value),IsNegative(c) ? Direction::Above : Direction::Below);
+				
+				return *this;
+			
+			}
+			
+			
+			/**
+			 *	Multiplies this checked integer by \em b.
+			 *
+			 *	\tparam U
+			 *		The type of \em b, which may be an integer, a
+			 *		safe integer, or a checked integer.
+			 *
+			 *	\param [in] b
+			 *		The right hand side.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			template <typename U>
+			Checked & operator *= (U b) noexcept {
+			
+				bool was=overflowed;
+				T c;
+				convert(b,c);
+				//	Multiplying by a positive number only moves
+				//	further from zero
+				follow(was,c>0,c>0);
+				auto d=(IsNegative(value)!=IsNegative(c)) ? Direction::Below : Direction::Above;
+				overflow(MultiplyOverflows(value,c,value),d);
+				
+				return *this;
+			
+			}
+			
+			
+			/**
+			 *	Divides this checked integer by \em b.
+			 *
+			 *	\tparam U
+			 *		The type of \em b, which may be an integer, a
+			 *		safe integer, or a checked integer.
+			 *
+			 *	\param [in] b
+			 *		The right hand side.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			template <typename U>
+			Checked & operator /= (U b) noexcept {
+			
+				bool was=overflowed;
+				T c;
+				convert(b,c);
+				//	Dividing only moves toward zero
+				follow(was,c==1,c==1);
+				bool d=DivideOverflows(value,c);
+				//	The quotient of division by zero goes out of
+				//	range in the direction of the dividend, unless
+				//	that's also zero
+				overflow(d,(c!=0) ? Direction::Above : ((value==0) ? Direction::Undefined : (IsNegative(value) ? Direction::Below : Direction::Above)));
+				//	Dividing by one instead means there's no
+				//	branch and nothing undefined
+				value/=d ? T(1) : c;
+				
+				return *this;
+			
+			}
+			
+			
+			/**
+			 *	Finds the remainder of dividing this checked
+			 *	integer by \em b.
+			 *
+			 *	\tparam U
+			 *		The type of \em b, which may be an integer, a
+			 *		safe integer, or a checked integer.
+			 *
+			 *	\param [in] b
+			 *		The right hand side.
+			 *
+			 *	\return
+			 *		A reference to this object.
+			 */
+			template <typename U>
+			Checked & operator %= (U b) noexcept {
+			
+				bool was=overflowed;
+				T c;
+				convert(b,c);
+				follow(was,false,false);
+				bool d=DivideOverflows(value,c);
+				overflow(d,Direction::Undefined);
+				value%=d ? T(1) : c;
+				
+				return *this;
+			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	Checked<A,PA> operator + (Checked<A,PA> a, Checked<B,PB> b) noexcept {
+	
+		return a+=b;
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Checked<A,P>>::type operator + (Checked<A,P> a, B b) noexcept {
+	
+		return a+=b;
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	typename std::enable_if<std::is_integral<A>::value,Checked<A,P>>::type operator + (A a, Checked<B,P> b) noexcept {
+	
+		return Checked<A,P>(a)+=b;
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em b from \em a.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	Checked<A,PA> operator - (Checked<A,PA> a, Checked<B,PB> b) noexcept {
+	
+		return a-=b;
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em b from \em a.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Checked<A,P>>::type operator - (Checked<A,P> a, B b) noexcept {
+	
+		return a-=b;
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em b from \em a.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	typename std::enable_if<std::is_integral<A>::value,Checked<A,P>>::type operator - (A a, Checked<B,P> b) noexcept {
+	
+		return Checked<A,P>(a)-=b;
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	Checked<A,PA> operator * (Checked<A,PA> a, Checked<B,PB> b) noexcept {
+	
+		return a*=b;
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Checked<A,P>>::type operator * (Checked<A,P> a, B b) noexcept {
+	
+		return a*=b;
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	typename std::enable_if<std::is_integral<A>::value,Checked<A,P>>::type operator * (A a, Checked<B,P> b) noexcept {
+	
+		return Checked<A,P>(a)*=b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	Checked<A,PA> operator / (Checked<A,PA> a, Checked<B,PB> b) noexcept {
+	
+		return a/=b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Checked<A,P>>::type operator / (Checked<A,P> a, B b) noexcept {
+	
+		return a/=b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	typename std::enable_if<std::is_integral<A>::value,Checked<A,P>>::type operator / (A a, Checked<B,P> b) noexcept {
+	
+		return Checked<A,P>(a)/=b;
+	
+	}
+	
+	
+	/**
+	 *	Finds the remainder of dividing \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam PA
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam PB
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename PA, typename B, typename PB>
+	Checked<A,PA> operator % (Checked<A,PA> a, Checked<B,PB> b) noexcept {
+	
+		return a%=b;
+	
+	}
+	
+	
+	/**
+	 *	Finds the remainder of dividing \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The checked integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename P, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Checked<A,P>>::type operator % (Checked<A,P> a, B b) noexcept {
+	
+		return a%=b;
+	
+	}
+	
+	
+	/**
+	 *	Finds the remainder of dividing \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place.
+	 *
+	 *	\tparam A
+	 *		The type of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The checked integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, typename B, typename P>
+	typename std::enable_if<std::is_integral<A>::value,Checked<A,P>>::type operator % (A a, Checked<B,P> b) noexcept {
+	
+		return Checked<A,P>(a)%=b;
+	
+	}
+	
+	
+	template <typename T, T Lo, T Hi>
+	class Bounded;
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	class Unchecked {	};
+	
+	
+	//	The bounds of the results of operations on bounded
+	//	integers are computed as std::intmax_t, which every
+	//	bound is required to be representable by
+	constexpr bool BoundAddOverflows (std::intmax_t a, std::intmax_t b) noexcept {
+	
+		return (b<0) ? (a<(std::numeric_limits<std::intmax_t>::min()-b)) : (a>(std::numeric_limits<std::intmax_t>::max()-b));
+	
+	}
+	
+	
+	constexpr bool BoundSubtractOverflows (std::intmax_t a, std::intmax_t b) noexcept {
+	
+		return (b<0) ? (a>(std::numeric_limits<std::intmax_t>::max()+b)) : (a<(std::numeric_limits<std::intmax_t>::min()+b));
+	
+	}
+	
+	
+	constexpr bool BoundMultiplyOverflows (std::intmax_t a, std::intmax_t b) noexcept {
+	
+		return ((a==0) || (b==0)) ? false : (
+			((a<0)==(b<0))
+				?	((a<0) ? (a<(std::numeric_limits<std::intmax_t>::max()/b)) : (a>(std::numeric_limits<std::intmax_t>::max()/b)))
+				:	((a<0) ? (a<(std::numeric_limits<std::intmax_t>::min()/b)) : (b<(std::numeric_limits<std::intmax_t>::min()/a)))
+		);
+	
+	}
+	
+	
+	constexpr std::intmax_t BoundMin (std::intmax_t a, std::intmax_t b) noexcept {
+	
+		return (a<b) ? a : b;
+	
+	}
+	
+	
+	constexpr std::intmax_t BoundMax (std::intmax_t a, std::intmax_t b) noexcept {
+	
+		return (a<b) ? b : a;
+	
+	}
+	
+	
+	//	Determines whether the range from l to h is within
+	//	the range from lo to hi
+	constexpr bool BoundWithin (std::intmax_t l, std::intmax_t h, std::intmax_t lo, std::intmax_t hi) noexcept {
+	
+		return (l>=lo) && (h<=hi);
+	
+	}
+	
+	
+	//	The largest remainder of division by i
+	constexpr std::intmax_t BoundRemainder (std::intmax_t i) noexcept {
+	
+		return (i<0) ? -(i+1) : ((i==0) ? 0 : (i-1));
+	
+	}
+	
+	
+	template <typename T, std::intmax_t Lo, std::intmax_t Hi>
+	class Fits : public std::integral_constant<bool,InRange<T>(Lo) && InRange<T>(Hi)> {	};
+	
+	
+	//	The narrowest integer type at least as wide as int
+	//	which can represent every value from Lo to Hi
+	template <bool Signed, std::intmax_t Lo, std::intmax_t Hi>
+	class Fitting : public std::conditional<
+		Fits<int,Lo,Hi>::value,
+		int,
+		typename std::conditional<Fits<long,Lo,Hi>::value,long,long long>::type
+	> {	};
+	
+	
+	template <std::intmax_t Lo, std::intmax_t Hi>
+	class Fitting<false,Lo,Hi> : public std::conditional<
+		Fits<unsigned int,Lo,Hi>::value,
+		unsigned int,
+		typename std::conditional<Fits<unsigned long,Lo,Hi>::value,unsigned long,unsigned long long>::type
+	> {	};
+	
+	
+	//	Given the bounds of the result of an operation on
+	//	bounded integers determines:
+	//
+	//	-	The type the operation is performed in, which can
+	//		represent both operands and the result
+	//	-	The type of the result, which is the type of the
+	//		left hand side if it can represent the result,
+	//		otherwise the narrowest type which can
+	template <typename A, std::intmax_t LA, std::intmax_t HA, typename B, std::intmax_t LB, std::intmax_t HB, std::intmax_t Lo, std::intmax_t Hi>
+	class BoundedOperation {
+	
+	
+		public:
+		
+		
+			typedef typename Fitting<
+				std::is_signed<A>::value || std::is_signed<B>::value || (Lo<0),
+				BoundMin(BoundMin(LA,LB),Lo),
+				BoundMax(BoundMax(HA,HB),Hi)
+			>::type Compute;
+			typedef typename std::conditional<
+				Fits<A,Lo,Hi>::value,
+				A,
+				typename Fitting<std::is_signed<A>::value || (Lo<0),Lo,Hi>::type
+			>::type Type;
+			typedef Bounded<Type,static_cast<Type>(Lo),static_cast<Type>(Hi)> Result;
+	
+	
+	};
+	
+	
+	template <typename A, std::intmax_t LA, std::intmax_t HA, typename B, std::intmax_t LB, std::intmax_t HB>
+	class AddBounds : public BoundedOperation<
+		A,LA,HA,
+		B,LB,HB,
+		BoundAddOverflows(LA,LB) ? 0 : (LA+LB),
+		BoundAddOverflows(HA,HB) ? 0 : (HA+HB)
+	> {
+	
+	
+		static_assert(!(BoundAddOverflows(LA,LB) || BoundAddOverflows(HA,HB)),"Bounds of sum cannot be represented");
+	
+	
+	};
+	
+	
+	template <typename A, std::intmax_t LA, std::intmax_t HA, typename B, std::intmax_t LB, std::intmax_t HB>
+	class SubtractBounds : public BoundedOperation<
+		A,LA,HA,
+		B,LB,HB,
+		BoundSubtractOverflows(LA,HB) ? 0 : (LA-HB),
+		BoundSubtractOverflows(HA,LB) ? 0 : (HA-LB)
+	> {
+	
+	
+		static_assert(!(BoundSubtractOverflows(LA,HB) || BoundSubtractOverflows(HA,LB)),"Bounds of difference cannot be represented");
+	
+	
+	};
+	
+	
+	template <typename A, std::intmax_t LA, std::intmax_t HA, typename B, std::intmax_t LB, std::intmax_t HB>
+	class MultiplyBounds {
+	
+	
+		private:
+		
+		
+			static constexpr bool overflows=BoundMultiplyOverflows(LA,LB) || BoundMultiplyOverflows(LA,HB) || BoundMultiplyOverflows(HA,LB) || BoundMultiplyOverflows(HA,HB);
+			
+			
+			static_assert(!overflows,"Bounds of product cannot be represented");
+			
+			
+			//	The product of the bounds is the bound of the
+			//	product, so the extremes are at the corners
+			static constexpr std::intmax_t a=overflows ? 0 : (LA*LB);
+			static constexpr std::intmax_t b=overflows ? 0 : (LA*HB);
+			static constexpr std::intmax_t c=overflows ? 0 : (HA*LB);
+			static constexpr std::intmax_t d=overflows ? 0 : (HA*HB);
+			
+			
+			typedef BoundedOperation<
+				A,LA,HA,
+				B,LB,HB,
+				BoundMin(BoundMin(a,b),BoundMin(c,d)),
+				BoundMax(BoundMax(a,b),BoundMax(c,d))
+			> base;
+		
+		
+		public:
+		
+		
+			typedef typename base::Compute Compute;
+			typedef typename base::Type Type;
+			typedef typename base::Result Result;
+	
+	
+	};
+	
+	
+	template <typename A, std::intmax_t LA, std::intmax_t HA, typename B, std::intmax_t LB, std::intmax_t HB>
+	class DivideBounds {
+	
+	
+		private:
+		
+		
+			static_assert((LB>0) || (HB<0),"Divisor may be zero");
+			
+			
+			static constexpr bool zero=(LB<=0) && (HB>=0);
+			static constexpr bool overflows=(LA==std::numeric_limits<std::intmax_t>::min()) && (HB==-1);
+			
+			
+			static_assert(!overflows,"Bounds of quotient cannot be represented");
+			
+			
+			//	With a divisor of constant sign the quotient is
+			//	monotonic in each operand, so the extremes are at
+			//	the corners
+			static constexpr std::intmax_t a=(zero || overflows) ? 0 : (LA/LB);
+			static constexpr std::intmax_t b=(zero || overflows) ? 0 : (LA/HB);
+			static constexpr std::intmax_t c=(zero || overflows) ? 0 : (HA/LB);
+			static constexpr std::intmax_t d=(zero || overflows) ? 0 : (HA/HB);
+			
+			
+			typedef BoundedOperation<
+				A,LA,HA,
+				B,LB,HB,
+				BoundMin(BoundMin(a,b),BoundMin(c,d)),
+				BoundMax(BoundMax(a,b),BoundMax(c,d))
+			> base;
+		
+		
+		public:
+		
+		
+			typedef typename base::Compute Compute;
+			typedef typename base::Type Type;
+			typedef typename base::Result Result;
+	
+	
+	};
+	
+	
+	template <typename A, std::intmax_t LA, std::intmax_t HA, typename B, std::intmax_t LB, std::intmax_t HB>
+	class ModulusBounds {
+	
+	
+		private:
+		
+		
+			static_assert((LB>0) || (HB<0),"Divisor may be zero");
+			
+			
+			//	The remainder has the sign of the dividend and
+			//	is smaller in magnitude than both the dividend
+			//	and the divisor
+			static constexpr std::intmax_t r=BoundMax(BoundRemainder(LB),BoundRemainder(HB));
+			
+			
+			typedef BoundedOperation<
+				A,LA,HA,
+				B,LB,HB,
+				(LA<0) ? BoundMax(LA,-r) : 0,
+				(HA>0) ? BoundMin(HA,r) : 0
+			> base;
+		
+		
+		public:
+		
+		
+			typedef typename base::Compute Compute;
+			typedef typename base::Type Type;
+			typedef typename base::Result Result;
+	
+	
+	};
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	An integer which is known at compile time to be within
+	 *	a certain range.
+	 *
+	 *	The bounds of the result of arithmetic on bounded
+	 *	integers are computed at compile time, and the result
+	 *	is represented by a type which is wide enough, so the
+	 *	arithmetic never needs to be checked at runtime.  Only
+	 *	conversions which may narrow the range are checked,
+	 *	and throw a Safe::OverflowError if they go out of
+	 *	range.
+	 *
+	 *	Both bounds must be representable by std::intmax_t.
+	 *	Divisors must not have zero within their range.
+	 *
+	 *	\tparam T
+	 *		The type of integer to wrap.
+	 *	\tparam Lo
+	 *		The smallest value.
+	 *	\tparam Hi
+	 *		The largest value.
+	 */
+	template <typename T, T Lo, T Hi>
+	class Bounded {
+	
+	
+		private:
+		
+		
+			T value;
+			
+			
+			template <typename U>
+			static constexpr T check (U i) {
+			
+				return (InRange<T>(i) && (static_cast<T>(i)>=Lo) && (static_cast<T>(i)<=Hi)) ? static_cast<T>(i) : (Raise<T>(Operation::Cast,i),T());
+			
+			}
+		
+		
+		public:
+		
+		
+			static_assert(std::is_integral<T>::value,"Safe::Bounded may only wrap integers");
+			static_assert(Lo<=Hi,"Lower bound of Safe::Bounded may not be greater than upper bound");
+			static_assert(InRange<std::intmax_t>(Hi),"Bounds of Safe::Bounded must be representable by std::intmax_t");
+			
+			
+			/**
+			 *	The type of integer this bounded integer wraps.
+			 */
+			typedef T Type;
+			
+			
+			/**
+			 *	Creates a bounded integer with the value within
+			 *	its range which is closest to zero.
+			 */
+			constexpr Bounded () noexcept : value((Lo>0) ? Lo : (IsNegative(Hi) ? Hi : 0)) {	}
+			/**
+			 *	\cond
+			 */
+			constexpr Bounded (T i, Unchecked) noexcept : value(i) {	}
+			/**
+			 *	\endcond
+			 */
+			/**
+			 *	Creates a bounded integer from an integer or a
+			 *	safe integer.
+			 *
+			 *	\tparam U
+			 *		The type of \em i.
+			 *
+			 *	\param [in] i
+			 *		The integer, which must be within range.
+			 */
+			template <typename U>
+			constexpr Bounded (U i) : value(check(Unwrapped<U>::Get(i))) {	}
+			/**
+			 *	Creates a bounded integer from a bounded integer
+			 *	of another type, which is only checked if the
+			 *	range of \em i is not within the range of this
+			 *	bounded integer.
+			 *
+			 *	\tparam U
+			 *		The integer type of \em i.
+			 *	\tparam L
+			 *		The smallest value of \em i.
+			 *	\tparam H
+			 *		The largest value of \em i.
+			 *
+			 *	\param [in] i
+			 *		The bounded integer.
+			 */
+			template <typename U, U L, U H>
+			constexpr Bounded (Bounded<U,L,H> i) noexcept(BoundWithin(L,H,Lo,Hi))
+				:	value(BoundWithin(L,H,Lo,Hi) ? static_cast<T>(i.Get()) : check(i.Get()))
+			{	}
+			
+			
+			/**
+			 *	Retrieves the value.
 			 *
 			 *	\return
-			 *		A reference to this object.
+			 *		The value.
 			 */
-			Integer & operator = (IntegerType i) noexcept {
+			constexpr T Get () const noexcept {
+			
+				return value;
+			
+			}
+			
+			
+			/**
+			 *	Retrieves the value.
+			 *
+			 *	\return
+			 *		The value.
+			 */
+			constexpr explicit operator T () const noexcept {
+			
+				return value;
+			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	The bounds of the result are computed at compile
+	 *	time, and the result is represented by \em A if it
+	 *	can represent those bounds, otherwise by the
+	 *	narrowest type which can.  The operation is not
+	 *	checked at runtime.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam LA
+	 *		The smallest value of \em a.
+	 *	\tparam HA
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam LB
+	 *		The smallest value of \em b.
+	 *	\tparam HB
+	 *		The largest value of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The bounded integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A LA, A HA, typename B, B LB, B HB>
+	constexpr typename AddBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)>::Result operator + (Bounded<A,LA,HA> a, Bounded<B,LB,HB> b) noexcept {
+	
+		typedef AddBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)> bounds;
+		typedef typename bounds::Compute type;
+		
+		return typename bounds::Result(static_cast<typename bounds::Type>(static_cast<type>(a.Get())+static_cast<type>(b.Get())),Unchecked());
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B, typename P>
+	Integer<A,P> operator + (Bounded<A,Lo,Hi> a, Integer<B,P> b) {
+	
+		return Integer<A,P>(a.Get())+b;
+	
+	}
+	
+	
+	/**
+	 *	Adds \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Integer<A>>::type operator + (Bounded<A,Lo,Hi> a, B b) {
+	
+		return Integer<A>(a.Get())+b;
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em b from \em a.
+	 *
+	 *	The bounds of the result are computed at compile
+	 *	time, and the result is represented by \em A if it
+	 *	can represent those bounds, otherwise by the
+	 *	narrowest type which can.  The operation is not
+	 *	checked at runtime.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam LA
+	 *		The smallest value of \em a.
+	 *	\tparam HA
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam LB
+	 *		The smallest value of \em b.
+	 *	\tparam HB
+	 *		The largest value of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The bounded integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A LA, A HA, typename B, B LB, B HB>
+	constexpr typename SubtractBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)>::Result operator - (Bounded<A,LA,HA> a, Bounded<B,LB,HB> b) noexcept {
+	
+		typedef SubtractBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)> bounds;
+		typedef typename bounds::Compute type;
+		
+		return typename bounds::Result(static_cast<typename bounds::Type>(static_cast<type>(a.Get())-static_cast<type>(b.Get())),Unchecked());
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em b from \em a.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B, typename P>
+	Integer<A,P> operator - (Bounded<A,Lo,Hi> a, Integer<B,P> b) {
+	
+		return Integer<A,P>(a.Get())-b;
+	
+	}
+	
+	
+	/**
+	 *	Subtracts \em b from \em a.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Integer<A>>::type operator - (Bounded<A,Lo,Hi> a, B b) {
+	
+		return Integer<A>(a.Get())-b;
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	The bounds of the result are computed at compile
+	 *	time, and the result is represented by \em A if it
+	 *	can represent those bounds, otherwise by the
+	 *	narrowest type which can.  The operation is not
+	 *	checked at runtime.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam LA
+	 *		The smallest value of \em a.
+	 *	\tparam HA
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam LB
+	 *		The smallest value of \em b.
+	 *	\tparam HB
+	 *		The largest value of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The bounded integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A LA, A HA, typename B, B LB, B HB>
+	constexpr typename MultiplyBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)>::Result operator * (Bounded<A,LA,HA> a, Bounded<B,LB,HB> b) noexcept {
+	
+		typedef MultiplyBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)> bounds;
+		typedef typename bounds::Compute type;
+		
+		return typename bounds::Result(static_cast<typename bounds::Type>(static_cast<type>(a.Get())*static_cast<type>(b.Get())),Unchecked());
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B, typename P>
+	Integer<A,P> operator * (Bounded<A,Lo,Hi> a, Integer<B,P> b) {
+	
+		return Integer<A,P>(a.Get())*b;
+	
+	}
+	
+	
+	/**
+	 *	Multiplies \em a and \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Integer<A>>::type operator * (Bounded<A,Lo,Hi> a, B b) {
+	
+		return Integer<A>(a.Get())*b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	The bounds of the result are computed at compile
+	 *	time, and the result is represented by \em A if it
+	 *	can represent those bounds, otherwise by the
+	 *	narrowest type which can.  The operation is not
+	 *	checked at runtime.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam LA
+	 *		The smallest value of \em a.
+	 *	\tparam HA
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam LB
+	 *		The smallest value of \em b.
+	 *	\tparam HB
+	 *		The largest value of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The bounded integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A LA, A HA, typename B, B LB, B HB>
+	constexpr typename DivideBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)>::Result operator / (Bounded<A,LA,HA> a, Bounded<B,LB,HB> b) noexcept {
+	
+		typedef DivideBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)> bounds;
+		typedef typename bounds::Compute type;
+		
+		return typename bounds::Result(static_cast<typename bounds::Type>(static_cast<type>(a.Get())/static_cast<type>(b.Get())),Unchecked());
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B, typename P>
+	Integer<A,P> operator / (Bounded<A,Lo,Hi> a, Integer<B,P> b) {
+	
+		return Integer<A,P>(a.Get())/b;
+	
+	}
+	
+	
+	/**
+	 *	Divides \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Integer<A>>::type operator / (Bounded<A,Lo,Hi> a, B b) {
+	
+		return Integer<A>(a.Get())/b;
+	
+	}
+	
+	
+	/**
+	 *	Finds the remainder of dividing \em a by \em b.
+	 *
+	 *	The bounds of the result are computed at compile
+	 *	time, and the result is represented by \em A if it
+	 *	can represent those bounds, otherwise by the
+	 *	narrowest type which can.  The operation is not
+	 *	checked at runtime.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam LA
+	 *		The smallest value of \em a.
+	 *	\tparam HA
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam LB
+	 *		The smallest value of \em b.
+	 *	\tparam HB
+	 *		The largest value of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The bounded integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A LA, A HA, typename B, B LB, B HB>
+	constexpr typename ModulusBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)>::Result operator % (Bounded<A,LA,HA> a, Bounded<B,LB,HB> b) noexcept {
+	
+		typedef ModulusBounds<A,static_cast<std::intmax_t>(LA),static_cast<std::intmax_t>(HA),B,static_cast<std::intmax_t>(LB),static_cast<std::intmax_t>(HB)> bounds;
+		typedef typename bounds::Compute type;
+		
+		return typename bounds::Result(static_cast<typename bounds::Type>(static_cast<type>(a.Get())%static_cast<type>(b.Get())),Unchecked());
+	
+	}
+	
+	
+	/**
+	 *	Finds the remainder of dividing \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B, typename P>
+	Integer<A,P> operator % (Bounded<A,Lo,Hi> a, Integer<B,P> b) {
+	
+		return Integer<A,P>(a.Get())%b;
+	
+	}
+	
+	
+	/**
+	 *	Finds the remainder of dividing \em a by \em b.
+	 *
+	 *	Note that \em b is always converted to type \em A before
+	 *	the operation takes place, and that the operation is
+	 *	checked.
+	 *
+	 *	\tparam A
+	 *		The integer type of \em a.
+	 *	\tparam Lo
+	 *		The smallest value of \em a.
+	 *	\tparam Hi
+	 *		The largest value of \em a.
+	 *	\tparam B
+	 *		The type of \em b.
+	 *
+	 *	\param [in] a
+	 *		The bounded integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The integer which is on the right hand side.
+	 *
+	 *	\return
+	 *		The result.
+	 */
+	template <typename A, A Lo, A Hi, typename B>
+	typename std::enable_if<std::is_integral<B>::value,Integer<A>>::type operator % (Bounded<A,Lo,Hi> a, B b) {
+	
+		return Integer<A>(a.Get())%b;
+	
+	}
+	
+	
+	/**
+	 *	Casts a bounded integer to another integer type.
+	 *
+	 *	The cast is only checked if \em B cannot represent
+	 *	every value within the bounds of \em from, in which
+	 *	case \em Policy is invoked when \em from is out of
+	 *	range of \em B.
+	 *
+	 *	\tparam B
+	 *		The type of integer to cast to.
+	 *	\tparam Policy
+	 *		The overflow policy.
+	 *	\tparam A
+	 *		The integer type of \em from.
+	 *	\tparam Lo
+	 *		The smallest value of \em from.
+	 *	\tparam Hi
+	 *		The largest value of \em from.
+	 *
+	 *	\param [in] from
+	 *		The bounded integer.
+	 *
+	 *	\return
+	 *		\em from represented as type \em B.
+	 */
+	template <typename B, typename Policy, typename A, A Lo, A Hi>
+	typename std::enable_if<std::is_class<Policy>::value,B>::type Cast (Bounded<A,Lo,Hi> from) noexcept(
+		Fits<B,static_cast<std::intmax_t>(Lo),static_cast<std::intmax_t>(Hi)>::value ||
+		noexcept(Policy::Overflow(std::declval<B>(),Direction::Above,Operation::Cast,std::declval<A>()))
+	) {
+	
+		auto i=from.Get();
+		if (!Fits<B,static_cast<std::intmax_t>(Lo),static_cast<std::intmax_t>(Hi)>::value && SAFE_UNLIKELY(!InRange<B>(i))) return Policy::Overflow(
+			static_cast<B>(i),
+			IsNegative(i) ? Direction::Below : Direction::Above,
+			Operation::Cast,
+			i
+		);
+		
+		return static_cast<B>(i);
+	
+	}
+	
+	
+	/**
+	 *	Casts a bounded integer to another integer type.
+	 *
+	 *	The cast is only checked if \em B cannot represent
+	 *	every value within the bounds of \em from, in which
+	 *	case it may throw.
+	 *
+	 *	\tparam B
+	 *		The type of integer to cast to.
+	 *	\tparam A
+	 *		The integer type of \em from.
+	 *	\tparam Lo
+	 *		The smallest value of \em from.
+	 *	\tparam Hi
+	 *		The largest value of \em from.
+	 *
+	 *	\param [in] from
+	 *		The bounded integer.
+	 *
+	 *	\return
+	 *		\em from represented as type \em B.
+	 */
+	template <typename B, typename A, A Lo, A Hi>
+	B Cast (Bounded<A,Lo,Hi> from) noexcept(Fits<B,static_cast<std::intmax_t>(Lo),static_cast<std::intmax_t>(Hi)>::value) {
+	
+		return Cast<B,Throw>(from);
+	
+	}
+	
+	
+	/**
+	 *	\cond
+	 */
+	
+	
+	//	The widest type expressions may be evaluated in, which
+	//	must be one the checked arithmetic can be performed in
+	//	when no type is wide enough to evaluate exactly
+	#if defined(SAFE_INT128) && defined(SAFE_BUILTINS)
+	typedef Int128 WidestExpressionType;
+	#else
+	typedef long long WidestExpressionType;
+	#endif
+	
+	
+	//	Finds the narrowest type at least as wide as int which
+	//	can represent every Bits bit signed integer, falling
+	//	back to the widest type (in which case the arithmetic
+	//	must be checked)
+	template <std::size_t Bits>
+	class ExpressionType : public std::conditional<
+		SelectWidth<
+			(Bits+std::numeric_limits<unsigned char>::digits-1)/std::numeric_limits<unsigned char>::digits,
+			int,
+			long,
+			long long
+			#if defined(SAFE_INT128) && defined(SAFE_BUILTINS)
+			,Int128
+			#endif
+		>::Exists,
+		SelectWidth<
+			(Bits+std::numeric_limits<unsigned char>::digits-1)/std::numeric_limits<unsigned char>::digits,
+			int,
+			long,
+			long long
+			#if defined(SAFE_INT128) && defined(SAFE_BUILTINS)
+			,Int128
+			#endif
+		>,
+		Found<WidestExpressionType>
+	>::type {	};
+	
+	
+	template <typename T>
+	constexpr std::size_t ExpressionBits () noexcept {
+	
+		return sizeof(T)*std::numeric_limits<unsigned char>::digits;
+	
+	}
+	
+	
+	//	Converts the value of a subexpression, which requires
+	//	Bits bits, to the type of its parent expression, which
+	//	may only go out of range when the parent is evaluated
+	//	in the widest type
+	template <typename T, std::size_t Bits, typename U>
+	typename std::enable_if<Bits<=ExpressionBits<T>(),T>::type ExpressionCast (U i, bool &) noexcept {
+	
+		return static_cast<T>(i);
+	
+	}
+	
+	
+	template <typename T, std::size_t Bits, typename U>
+	typename std::enable_if<(Bits>ExpressionBits<T>()) && std::is_same<T,U>::value,T>::type ExpressionCast (U i, bool &) noexcept {
+	
+		return i;
+	
+	}
+	
+	
+	template <typename T, std::size_t Bits, typename U>
+	typename std::enable_if<(Bits>ExpressionBits<T>()) && !std::is_same<T,U>::value,T>::type ExpressionCast (U i, bool & overflowed) noexcept {
+	
+		overflowed|=!InRange<T>(i);
+		
+		return static_cast<T>(i);
+	
+	}
+	
+	
+	//	Expressions may be evaluated in a type which isn't
+	//	a standard integer type, in which case it must be
+	//	wider than T
+	template <typename T, typename U>
+	constexpr typename std::enable_if<(sizeof(U)>sizeof(T)),bool>::type ExpressionInRange (U i) noexcept {
+	
+		return (i>=static_cast<U>(std::numeric_limits<T>::min())) && (i<=static_cast<U>(std::numeric_limits<T>::max()));
+	
+	}
+	
+	
+	template <typename T, typename U>
+	constexpr typename std::enable_if<sizeof(U)<=sizeof(T),bool>::type ExpressionInRange (U i) noexcept {
+	
+		return InRange<T>(i);
+	
+	}
+	
+	
+	//	An integer at the leaves of an expression
+	template <typename T>
+	class LeafExpression {
+	
+	
+		private:
+		
+		
+			T value;
+		
+		
+		public:
+		
+		
+			typedef T Type;
+			static constexpr std::size_t Bits=std::numeric_limits<T>::digits+1;
 			
-				this->i=std::move(i);
-				
-				return *this;
+			
+			constexpr explicit LeafExpression (T value) noexcept : value(value) {	}
+			
+			
+			constexpr T Evaluate (bool &) const noexcept {
+			
+				return value;
+			
+			}
+	
+	
+	};
+	
+	
+	class AddExpression {
+	
+	
+		public:
+		
+		
+			static constexpr std::size_t Bits (std::size_t a, std::size_t b) noexcept {
+			
+				return ((a<b) ? b : a)+1;
+			
+			}
+			
+			
+			template <typename T>
+			static constexpr T Apply (T a, T b) noexcept {
+			
+				return a+b;
+			
+			}
+			
+			
+			template <typename T>
+			static T Apply (T a, T b, bool &, std::true_type) noexcept {
+			
+				return a+b;
 			
 			}
 			
 			
-			/**
-			 *	Safely assigns an integer of another type to this
-			 *	safe integer.
-			 *
-			 *	\tparam T
-			 *		The type of the integer to assign.
-			 *
-			 *	\param [in] i
-			 *		The integer.
-			 *
-			 *	\return
-			 *		A reference to this object.
-			 */
 			template <typename T>
-			Integer & operator = (T i) noexcept(noexcept(Cast<IntegerType>(i))) {
+			static T Apply (T a, T b, bool & overflowed, std::false_type) noexcept {
 			
-				this->i=Cast<IntegerType>(i);
+				T r;
+				overflowed|=AddOverflows(a,b,r);
 				
-				return *this;
+				return r;
+			
+			}
+	
+	
+	};
+	
+	
+	class SubtractExpression {
+	
+	
+		public:
+		
+		
+			static constexpr std::size_t Bits (std::size_t a, std::size_t b) noexcept {
+			
+				return ((a<b) ? b : a)+1;
+			
+			}
+			
+			
+			template <typename T>
+			static constexpr T Apply (T a, T b) noexcept {
+			
+				return a-b;
+			
+			}
+			
+			
+			template <typename T>
+			static T Apply (T a, T b, bool &, std::true_type) noexcept {
+			
+				return a-b;
 			
 			}
 			
 			
-			/**
-			 *	Safely assigns a safe integer of another type to this
-			 *	safe integer.
-			 *
-			 *	\tparam T
-			 *		The type of integer wrapped by the safe integer
-			 *		type which shall be assigned to this safe integer.
-			 *
-			 *	\param [in] i
-			 *		The other safe integer.
-			 *
-			 *	\return
-			 *		A reference to this object.
-			 */
 			template <typename T>
-			Integer & operator = (Integer<T> i) noexcept(noexcept(Cast<IntegerType>(std::declval<T>()))) {
+			static T Apply (T a, T b, bool & overflowed, std::false_type) noexcept {
 			
-				this->i=Cast<IntegerType>(static_cast<T>(i));
+				T r;
+				overflowed|=SubtractOverflows(a,b,r);
 				
-				return *this;
+				return r;
 			
 			}
+	
+	
+	};
+	
+	
+	class MultiplyExpression {
+	
+	
+		public:
+		
+		
+			static constexpr std::size_t Bits (std::size_t a, std::size_t b) noexcept {
 			
+				return a+b;
 			
-			/**
-			 *	Retrieves the integer this safe integer represents.
-			 *
-			 *	\return
-			 *		The integer.
-			 */
-			constexpr operator IntegerType () const noexcept {
+			}
 			
-				return i;
+			
+			template <typename T>
+			static constexpr T Apply (T a, T b) noexcept {
+			
+				return a*b;
 			
 			}
 			
 			
-			/**
-			 *	Retrieves the integer this safe integer represents
-			 *	safely converted to an integer of another type.
-			 *
-			 *	\tparam T
-			 *		The other type.
-			 *
-			 *	\return
-			 *		The integer.
-			 */
 			template <typename T>
-			operator T () const noexcept(noexcept(Cast<T>(std::declval<IntegerType>()))) {
+			static T Apply (T a, T b, bool &, std::true_type) noexcept {
 			
-				return Cast<T>(i);
+				return a*b;
 			
 			}
 			
 			
-			/**
-			 *	Retrieves the integer this safe integer represents.
-			 *
-			 *	\return
-			 *		The integer.
-			 */
-			constexpr IntegerType Get () const noexcept {
+			template <typename T>
+			static T Apply (T a, T b, bool & overflowed, std::false_type) noexcept {
 			
-				return i;
+				T r;
+				overflowed|=MultiplyOverflows(a,b,r);
+				
+				return r;
+			
+			}
+	
+	
+	};
+	
+	
+	template <typename Operator, typename A, typename B>
+	class BinaryExpression {
+	
+	
+		private:
+		
+		
+			A a;
+			B b;
+		
+		
+		public:
+		
+		
+			static constexpr std::size_t Bits=Operator::Bits(A::Bits,B::Bits);
+			typedef typename ExpressionType<Bits>::Type Type;
+			
+			
+			constexpr BinaryExpression (A a, B b) noexcept : a(a), b(b) {	}
+			
+			
+			Type Evaluate (bool & overflowed) const noexcept {
+			
+				return Operator::Apply(
+					ExpressionCast<Type,A::Bits>(a.Evaluate(overflowed),overflowed),
+					ExpressionCast<Type,B::Bits>(b.Evaluate(overflowed),overflowed),
+					overflowed,
+					std::integral_constant<bool,Bits<=ExpressionBits<Type>()>()
+				);
 			
 			}
+	
+	
+	};
+	
+	
+	template <typename A>
+	class NegateExpression {
+	
+	
+		private:
+		
+		
+			A a;
+		
+		
+		public:
+		
+		
+			static constexpr std::size_t Bits=A::Bits+1;
+			typedef typename ExpressionType<Bits>::Type Type;
 			
 			
-			/**
-			 *	Retrieves the integer this safe integer represents
-			 *	safely converted to an integer of another type.
-			 *
-			 *	\tparam T
-			 *		The other type.
-			 *
-			 *	\return
-			 *		The integer.
+			constexpr explicit NegateExpression (A a) noexcept : a(a) {	}
+			
+			
+			Type Evaluate (bool & overflowed) const noexcept {
+			
+				return SubtractExpression::Apply(
+					Type(0),
+					ExpressionCast<Type,A::Bits>(a.Evaluate(overflowed),overflowed),
+					overflowed,
+					std::integral_constant<bool,Bits<=ExpressionBits<Type>()>()
+				);
+			
+			}
+	
+	
+	};
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	An arithmetic expression on integers which is not
+	 *	evaluated until its result is converted to an integer.
+	 *
+	 *	Each operation is performed in a type which is wide
+	 *	enough that it cannot overflow (i.e. a 64 bit integer
+	 *	for the product of 32 bit integers), so there is only
+	 *	a single check, when the result is converted.  When no
+	 *	type is wide enough the operations which could overflow
+	 *	are checked as they are performed, but still only
+	 *	reported when the result is converted.
+	 *
+	 *	Expressions are created by Safe::Lazy, and support
+	 *	addition, subtraction, multiplication, and unary minus.
+	 *
+	 *	\tparam Node
+	 *		The type of the expression tree.
+	 */
+	template <typename Node>
+	class Expression {
+	
+	
+		private:
+		
+		
+			Node node;
+		
+		
+		public:
+		
+		
+			/**
+			 *	The type of the expression tree.
 			 */
-			template <typename T>
-			T Get () const noexcept(noexcept(Cast<T>(std::declval<IntegerType>()))) {
-			
-				return Cast<T>(i);
-			
-			}
+			typedef Node NodeType;
 			
 			
 			/**
-			 *	Safely converts this safe integer to a safe integer of
-			 *	signed type.
+			 *	Creates an expression.
 			 *
-			 *	\return
-			 *		A safe integer which wraps an integer type of
-			 *		the same width as \em IntegerType, except signed,
-			 *		and which contains the same value as this safe
-			 *		integer.
+			 *	\param [in] node
+			 *		The expression tree.
 			 */
-			Integer<SignedType> MakeSigned () const noexcept(std::is_same<SignedType,IntegerType>::value) {
-			
-				return Integer<SignedType>(i);
-			
-			}
+			constexpr explicit Expression (Node node) noexcept : node(node) {	}
 			
 			
 			/**
-			 *	Safely converts this safe integer to a safe integer of
-			 *	unsigned type.
+			 *	Retrieves the expression tree.
 			 *
 			 *	\return
-			 *		A safe integer which wraps an integer type of
-			 *		the same width as \em IntegerType, except unsigned,
-			 *		and which contains the same value as this safe
-			 *		integer.
+			 *		The expression tree.
 			 */
-			Integer<UnsignedType> MakeUnsigned () const noexcept(std::is_same<UnsignedType,IntegerType>::value) {
+			constexpr Node GetNode () const noexcept {
 			
-				return Integer<UnsignedType>(i);
+				return node;
 			
 			}
 			
 			
 			/**
-			 *	Finds the absolute value (i.e. magnitude) of a safe integer.
+			 *	Evaluates the expression.
+			 *
+			 *	\tparam T
+			 *		The type of integer to represent the result
+			 *		by.
+			 *	\tparam Policy
+			 *		The overflow policy, which is invoked if the
+			 *		result cannot be represented by \em T.
+			 *		Defaults to Safe::Throw.
 			 *
 			 *	\return
-			 *		A safe integer containing the magnitude of this safe
-			 *		integer.
+			 *		The result.
 			 */
-			Integer Abs () const {
-			
-				return Arithmetic<IntegerType>::Abs(i);
+			template <typename T, typename Policy=Throw>
+			T Get () const noexcept(noexcept(Policy::Overflow(std::declval<T>(),Direction::Above,Operation::Expression,std::declval<T>()))) {
+			
+				bool overflowed=false;
+				auto r=node.Evaluate(overflowed);
+				overflowed|=!ExpressionInRange<T>(r);
+				if (SAFE_UNLIKELY(overflowed)) return Policy::Overflow(
+					static_cast<T>(r),
+					(r<0) ? Direction::Below : Direction::Above,
+					Operation::Expression,
+					static_cast<T>(r)
+				);
+				
+				return static_cast<T>(r);
 			
 			}
 	
@@ -802,532 +9392,391 @@ namespace Safe {
 	
 	
 	/**
-	 *	Adds \em a and \em b, and assigns the result of the
-	 *	addition to \em a.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em a.
-	 *	\tparam B
-	 *		The type of \em b.
-	 *
-	 *	\param [in,out] a
-	 *		The safe integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The integer which is on the right hand side.
-	 *
-	 *	\return
-	 *		A reference to \em a.
+	 *	\cond
 	 */
-	template <typename A, typename B>
-	Integer<A> & operator += (Integer<A> & a, B b) {
 	
-		return a=Arithmetic<A>::Add(a.Get(),Integer<A>(b).Get());
 	
-	}
-	
-	
-	/**
-	 *	Adds \em a and \em b, and assigns the result of the
-	 *	addition to \em a.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
-	 *
-	 *	\param [in,out] a
-	 *		The safe integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
-	 *
-	 *	\return
-	 *		A reference to \em a.
-	 */
-	template <typename A, typename B>
-	Integer<A> & operator += (Integer<A> & a, Integer<B> b) {
+	template <typename T>
+	class ToExpression {
 	
-		return a+=b.Get();
 	
-	}
+		public:
+		
+		
+			typedef LeafExpression<T> Type;
+			
+			
+			static constexpr Type Get (T i) noexcept {
+			
+				return Type(i);
+			
+			}
 	
 	
-	/**
-	 *	Adds \em a and \em b, and assigns the result of the
-	 *	addition to \em a.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
-	 *
-	 *	\tparam A
-	 *		The type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
-	 *
-	 *	\param [in,out] a
-	 *		The integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
-	 *
-	 *	\return
-	 *		A reference to \em a.
-	 */
-	template <typename A, typename B>
-	A & operator += (A & a, Integer<B> b) {
+	};
 	
-		return a=Arithmetic<A>::Add(a,b.template Get<A>());
 	
-	}
+	template <typename T, typename P>
+	class ToExpression<Integer<T,P>> {
 	
 	
-	/**
-	 *	Adds \em a and \em b.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
-	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
-	 *
-	 *	\return
-	 *		The result.
-	 */
-	template <typename A, typename B>
-	Integer<A> operator + (Integer<A> a, Integer<B> b) {
+		public:
+		
+		
+			typedef LeafExpression<T> Type;
+			
+			
+			static constexpr Type Get (Integer<T,P> i) noexcept {
+			
+				return Type(i.Get());
+			
+			}
 	
-		return a+=b;
 	
-	}
+	};
 	
 	
-	/**
-	 *	Adds \em a and \em b.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em a.
-	 *	\tparam B
-	 *		The type of \em b.
-	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The integer which is on the right hand side.
-	 *
-	 *	\return
-	 *		The result.
-	 */
-	template <typename A, typename B>
-	Integer<A> operator + (Integer<A> a, B b) {
+	template <typename N>
+	class ToExpression<Expression<N>> {
 	
-		return a+=b;
 	
-	}
+		public:
+		
+		
+			typedef N Type;
+			
+			
+			static constexpr Type Get (Expression<N> e) noexcept {
+			
+				return e.GetNode();
+			
+			}
 	
 	
-	/**
-	 *	Adds \em a and \em b.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
-	 *
-	 *	\tparam A
-	 *		The type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
-	 *
-	 *	\param [in] a
-	 *		The integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
-	 *
-	 *	\return
-	 *		The result.
-	 */
-	template <typename A, typename B>
-	Integer<A> operator + (A a, Integer<B> b) {
+	};
 	
-		return a+=b;
 	
-	}
+	template <typename Operator, typename A, typename B>
+	class MakeExpression {
 	
 	
-	/**
-	 *	Increments a safe integer.
-	 *
-	 *	\tparam T
-	 *		The integer type of the safe integer.
-	 *
-	 *	\param [in,out] i
-	 *		The safe integer.
-	 *
-	 *	\return
-	 *		The safe integer.
-	 */
-	template <typename T>
-	Integer<T> & operator ++ (Integer<T> & i) {
+		public:
+		
+		
+			typedef Expression<BinaryExpression<Operator,typename ToExpression<A>::Type,typename ToExpression<B>::Type>> Type;
+			
+			
+			static constexpr Type Get (A a, B b) noexcept {
+			
+				return Type(typename Type::NodeType(ToExpression<A>::Get(a),ToExpression<B>::Get(b)));
+			
+			}
 	
-		return i+=1;
 	
-	}
+	};
 	
 	
 	/**
-	 *	Increments a safe integer.
-	 *
-	 *	\tparam T
-	 *		The integer type of the safe integer.
-	 *
-	 *	\param [in,out] i
-	 *		The safe integer.
-	 *
-	 *	\return
-	 *		A copy of the safe integer before it was
-	 *		incremented.
+	 *	\endcond
 	 */
-	template <typename T>
-	Integer<T> operator ++ (Integer<T> & i, int) {
-	
-		auto retr=i;
-		
-		++i;
-		
-		return retr;
-	
-	}
 	
 	
 	/**
-	 *	Subtracts \em a and \em b, and assigns the result of the
-	 *	subtraction to \em a.
+	 *	Begins an expression which is not evaluated until its
+	 *	result is converted to an integer.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em a.
-	 *	\tparam B
-	 *		The type of \em b.
+	 *	\tparam T
+	 *		The type of \em i, which may be an integer or a
+	 *		safe integer.
 	 *
-	 *	\param [in,out] a
-	 *		The safe integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The integer which is on the right hand side.
+	 *	\param [in] i
+	 *		The integer.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression whose value is \em i.
 	 */
-	template <typename A, typename B>
-	Integer<A> & operator -= (Integer<A> & a, B b) {
+	template <typename T>
+	constexpr Expression<typename ToExpression<T>::Type> Lazy (T i) noexcept {
 	
-		return a=Arithmetic<A>::Subtract(a.Get(),Integer<A>(b).Get());
+		return Expression<typename ToExpression<T>::Type>(ToExpression<T>::Get(i));
 	
 	}
 	
 	
 	/**
-	 *	Subtracts \em a and \em b, and assigns the result of the
-	 *	subtraction to \em a.
+	 *	Adds \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The integer type of \em a.
+	 *		The expression tree of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The expression tree of \em b.
 	 *
-	 *	\param [in,out] a
-	 *		The safe integer which is on the left hand side.
+	 *	\param [in] a
+	 *		The expression which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression.
 	 */
 	template <typename A, typename B>
-	Integer<A> & operator -= (Integer<A> & a, Integer<B> b) {
+	constexpr typename MakeExpression<AddExpression,Expression<A>,Expression<B>>::Type operator + (Expression<A> a, Expression<B> b) noexcept {
 	
-		return a-=b.Get();
+		return MakeExpression<AddExpression,Expression<A>,Expression<B>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Subtracts \em a and \em b, and assigns the result of the
-	 *	subtraction to \em a.
+	 *	Adds \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The type of \em a.
+	 *		The expression tree of \em a.
 	 *	\tparam B
 	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
 	 *
-	 *	\param [in,out] a
-	 *		The integer which is on the left hand side.
+	 *	\param [in] a
+	 *		The expression which is on the left hand side.
 	 *	\param [in] b
 	 *		The safe integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression.
 	 */
-	template <typename A, typename B>
-	A & operator -= (A & a, Integer<B> b) {
+	template <typename A, typename B, typename P>
+	constexpr typename MakeExpression<AddExpression,Expression<A>,Integer<B,P>>::Type operator + (Expression<A> a, Integer<B,P> b) noexcept {
 	
-		return a=Arithmetic<A>::Subtract(a,b.template Get<A>());
+		return MakeExpression<AddExpression,Expression<A>,Integer<B,P>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Subtracts \em a and \em b.
+	 *	Adds \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
 	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The expression tree of \em b.
 	 *
 	 *	\param [in] a
 	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		The result.
+	 *		An expression.
 	 */
-	template <typename A, typename B>
-	Integer<A> operator - (Integer<A> a, Integer<B> b) {
+	template <typename A, typename P, typename B>
+	constexpr typename MakeExpression<AddExpression,Integer<A,P>,Expression<B>>::Type operator + (Integer<A,P> a, Expression<B> b) noexcept {
 	
-		return a-=b;
+		return MakeExpression<AddExpression,Integer<A,P>,Expression<B>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Subtracts \em a and \em b.
+	 *	Adds \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The integer type of \em a.
+	 *		The expression tree of \em a.
 	 *	\tparam B
 	 *		The type of \em b.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side.
+	 *		The expression which is on the left hand side.
 	 *	\param [in] b
 	 *		The integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		The result.
+	 *		An expression.
 	 */
 	template <typename A, typename B>
-	Integer<A> operator - (Integer<A> a, B b) {
+	constexpr typename std::enable_if<std::is_integral<B>::value,typename MakeExpression<AddExpression,Expression<A>,B>::Type>::type operator + (Expression<A> a, B b) noexcept {
 	
-		return a-=b;
+		return MakeExpression<AddExpression,Expression<A>,B>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Subtracts \em a and \em b.
+	 *	Adds \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
 	 *		The type of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The expression tree of \em b.
 	 *
 	 *	\param [in] a
 	 *		The integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		The result.
+	 *		An expression.
 	 */
 	template <typename A, typename B>
-	Integer<A> operator - (A a, Integer<B> b) {
+	constexpr typename std::enable_if<std::is_integral<A>::value,typename MakeExpression<AddExpression,A,Expression<B>>::Type>::type operator + (A a, Expression<B> b) noexcept {
 	
-		return a-=b;
+		return MakeExpression<AddExpression,A,Expression<B>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Decrements a safe integer.
-	 *
-	 *	\tparam T
-	 *		The integer type of the safe integer.
-	 *
-	 *	\param [in,out] i
-	 *		The safe integer.
+	 *	Subtracts \em b from \em a.
 	 *
-	 *	\return
-	 *		The safe integer.
-	 */
-	template <typename T>
-	Integer<T> & operator -- (Integer<T> & i) {
-	
-		return i-=1;
-	
-	}
-	
-	
-	/**
-	 *	Decrements a safe integer.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
-	 *	\tparam T
-	 *		The integer type of the safe integer.
+	 *	\tparam A
+	 *		The expression tree of \em a.
+	 *	\tparam B
+	 *		The expression tree of \em b.
 	 *
-	 *	\param [in,out] i
-	 *		The safe integer.
+	 *	\param [in] a
+	 *		The expression which is on the left hand side.
+	 *	\param [in] b
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		A copy of the safe integer before it was
-	 *		decremented.
+	 *		An expression.
 	 */
-	template <typename T>
-	Integer<T> operator -- (Integer<T> & i, int) {
+	template <typename A, typename B>
+	constexpr typename MakeExpression<SubtractExpression,Expression<A>,Expression<B>>::Type operator - (Expression<A> a, Expression<B> b) noexcept {
 	
-		auto retr=i;
-		
-		--i;
-		
-		return retr;
+		return MakeExpression<SubtractExpression,Expression<A>,Expression<B>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Multiplies \em a and \em b, and assigns the result of the
-	 *	multiplication to \em a.
+	 *	Subtracts \em b from \em a.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The integer type of \em a.
+	 *		The expression tree of \em a.
 	 *	\tparam B
-	 *		The type of \em b.
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
 	 *
-	 *	\param [in,out] a
-	 *		The safe integer which is on the left hand side.
+	 *	\param [in] a
+	 *		The expression which is on the left hand side.
 	 *	\param [in] b
-	 *		The integer which is on the right hand side.
+	 *		The safe integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression.
 	 */
-	template <typename A, typename B>
-	Integer<A> & operator *= (Integer<A> & a, B b) {
+	template <typename A, typename B, typename P>
+	constexpr typename MakeExpression<SubtractExpression,Expression<A>,Integer<B,P>>::Type operator - (Expression<A> a, Integer<B,P> b) noexcept {
 	
-		return a=Arithmetic<A>::Multiply(a.Get(),Integer<A>(b).Get());
+		return MakeExpression<SubtractExpression,Expression<A>,Integer<B,P>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Multiplies \em a and \em b, and assigns the result of the
-	 *	multiplication to \em a.
+	 *	Subtracts \em b from \em a.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
 	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The expression tree of \em b.
 	 *
-	 *	\param [in,out] a
+	 *	\param [in] a
 	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression.
 	 */
-	template <typename A, typename B>
-	Integer<A> & operator *= (Integer<A> & a, Integer<B> b) {
+	template <typename A, typename P, typename B>
+	constexpr typename MakeExpression<SubtractExpression,Integer<A,P>,Expression<B>>::Type operator - (Integer<A,P> a, Expression<B> b) noexcept {
 	
-		return a*=b.Get();
+		return MakeExpression<SubtractExpression,Integer<A,P>,Expression<B>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Multiplies \em a and \em b, and assigns the result of the
-	 *	multiplication to \em a.
+	 *	Subtracts \em b from \em a.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The type of \em a.
+	 *		The expression tree of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The type of \em b.
 	 *
-	 *	\param [in,out] a
-	 *		The integer which is on the left hand side.
+	 *	\param [in] a
+	 *		The expression which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression.
 	 */
 	template <typename A, typename B>
-	A & operator *= (A & a, Integer<B> b) {
+	constexpr typename std::enable_if<std::is_integral<B>::value,typename MakeExpression<SubtractExpression,Expression<A>,B>::Type>::type operator - (Expression<A> a, B b) noexcept {
 	
-		return a=Arithmetic<A>::Multiply(a,b.template Get<A>());
+		return MakeExpression<SubtractExpression,Expression<A>,B>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Multiplies \em a and \em b.
+	 *	Subtracts \em b from \em a.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The integer type of \em a.
+	 *		The type of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The expression tree of \em b.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side.
+	 *		The integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		The result.
+	 *		An expression.
 	 */
 	template <typename A, typename B>
-	Integer<A> operator * (Integer<A> a, Integer<B> b) {
+	constexpr typename std::enable_if<std::is_integral<A>::value,typename MakeExpression<SubtractExpression,A,Expression<B>>::Type>::type operator - (A a, Expression<B> b) noexcept {
 	
-		return a*=b;
+		return MakeExpression<SubtractExpression,A,Expression<B>>::Get(a,b);
 	
 	}
 	
@@ -1335,26 +9784,26 @@ namespace Safe {
 	/**
 	 *	Multiplies \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The integer type of \em a.
+	 *		The expression tree of \em a.
 	 *	\tparam B
-	 *		The type of \em b.
+	 *		The expression tree of \em b.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side.
+	 *		The expression which is on the left hand side.
 	 *	\param [in] b
-	 *		The integer which is on the right hand side.
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		The result.
+	 *		An expression.
 	 */
 	template <typename A, typename B>
-	Integer<A> operator * (Integer<A> a, B b) {
+	constexpr typename MakeExpression<MultiplyExpression,Expression<A>,Expression<B>>::Type operator * (Expression<A> a, Expression<B> b) noexcept {
 	
-		return a*=b;
+		return MakeExpression<MultiplyExpression,Expression<A>,Expression<B>>::Get(a,b);
 	
 	}
 	
@@ -1362,286 +9811,306 @@ namespace Safe {
 	/**
 	 *	Multiplies \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The type of \em a.
+	 *		The expression tree of \em a.
 	 *	\tparam B
 	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
 	 *
 	 *	\param [in] a
-	 *		The integer which is on the left hand side.
+	 *		The expression which is on the left hand side.
 	 *	\param [in] b
 	 *		The safe integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		The result.
+	 *		An expression.
 	 */
-	template <typename A, typename B>
-	Integer<A> operator * (A a, Integer<B> b) {
+	template <typename A, typename B, typename P>
+	constexpr typename MakeExpression<MultiplyExpression,Expression<A>,Integer<B,P>>::Type operator * (Expression<A> a, Integer<B,P> b) noexcept {
 	
-		return a*=b;
+		return MakeExpression<MultiplyExpression,Expression<A>,Integer<B,P>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b, and assigns the result of the
-	 *	division to \em a.
+	 *	Multiplies \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
 	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
 	 *	\tparam B
-	 *		The type of \em b.
+	 *		The expression tree of \em b.
 	 *
-	 *	\param [in,out] a
+	 *	\param [in] a
 	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The integer which is on the right hand side.
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression.
 	 */
-	template <typename A, typename B>
-	Integer<A> & operator /= (Integer<A> & a, B b) {
+	template <typename A, typename P, typename B>
+	constexpr typename MakeExpression<MultiplyExpression,Integer<A,P>,Expression<B>>::Type operator * (Integer<A,P> a, Expression<B> b) noexcept {
 	
-		return a=Arithmetic<A>::Divide(a.Get(),Integer<A>(b).Get());
+		return MakeExpression<MultiplyExpression,Integer<A,P>,Expression<B>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b, and assigns the result of the
-	 *	division to \em a.
+	 *	Multiplies \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
-	 *		The integer type of \em a.
+	 *		The expression tree of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The type of \em b.
 	 *
-	 *	\param [in,out] a
-	 *		The safe integer which is on the left hand side.
+	 *	\param [in] a
+	 *		The expression which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression.
 	 */
 	template <typename A, typename B>
-	Integer<A> & operator /= (Integer<A> & a, Integer<B> b) {
+	constexpr typename std::enable_if<std::is_integral<B>::value,typename MakeExpression<MultiplyExpression,Expression<A>,B>::Type>::type operator * (Expression<A> a, B b) noexcept {
 	
-		return a/=b.Get();
+		return MakeExpression<MultiplyExpression,Expression<A>,B>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b, and assigns the result of the
-	 *	division to \em a.
+	 *	Multiplies \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The operation is not performed until the result of
+	 *	the expression is converted to an integer.
 	 *
 	 *	\tparam A
 	 *		The type of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The expression tree of \em b.
 	 *
-	 *	\param [in,out] a
+	 *	\param [in] a
 	 *		The integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The expression which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		An expression.
 	 */
 	template <typename A, typename B>
-	A & operator /= (A & a, Integer<B> b) {
+	constexpr typename std::enable_if<std::is_integral<A>::value,typename MakeExpression<MultiplyExpression,A,Expression<B>>::Type>::type operator * (A a, Expression<B> b) noexcept {
 	
-		return a=Arithmetic<A>::Divide(a,b.template Get<A>());
+		return MakeExpression<MultiplyExpression,A,Expression<B>>::Get(a,b);
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	Applies unary minus to an expression.
 	 *
-	 *	\tparam A
-	 *		The integer type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
+	 *	\tparam T
+	 *		The expression tree.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The expression.
 	 *
 	 *	\return
-	 *		The result.
+	 *		An expression.
 	 */
-	template <typename A, typename B>
-	Integer<A> operator / (Integer<A> a, Integer<B> b) {
+	template <typename T>
+	constexpr Expression<NegateExpression<T>> operator - (Expression<T> a) noexcept {
 	
-		return a/=b;
+		return Expression<NegateExpression<T>>(NegateExpression<T>(a.GetNode()));
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	Evaluates an expression and casts the result to an
+	 *	integer type.
 	 *
-	 *	\tparam A
-	 *		The integer type of \em a.
 	 *	\tparam B
-	 *		The type of \em b.
+	 *		The type of integer to cast to.
+	 *	\tparam Policy
+	 *		The overflow policy, which is invoked if the
+	 *		result cannot be represented by \em B.
+	 *	\tparam N
+	 *		The expression tree of \em from.
 	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The integer which is on the right hand side.
+	 *	\param [in] from
+	 *		The expression.
 	 *
 	 *	\return
-	 *		The result.
+	 *		The result represented as type \em B.
 	 */
-	template <typename A, typename B>
-	Integer<A> operator / (Integer<A> a, B b) {
+	template <typename B, typename Policy, typename N>
+	typename std::enable_if<std::is_class<Policy>::value,B>::type Cast (Expression<N> from) noexcept(noexcept(from.template Get<B,Policy>())) {
 	
-		return a/=b;
+		return from.template Get<B,Policy>();
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	Evaluates an expression and casts the result to an
+	 *	integer type, throwing if it is out of range.
 	 *
-	 *	\tparam A
-	 *		The type of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The type of integer to cast to.
+	 *	\tparam N
+	 *		The expression tree of \em from.
 	 *
-	 *	\param [in] a
-	 *		The integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *	\param [in] from
+	 *		The expression.
 	 *
 	 *	\return
-	 *		The result.
+	 *		The result represented as type \em B.
 	 */
-	template <typename A, typename B>
-	Integer<A> operator / (A a, Integer<B> b) {
+	template <typename B, typename N>
+	B Cast (Expression<N> from) {
 	
-		return a/=b;
+		return from.template Get<B>();
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b, and assigns the remainder to \em a.
-	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em a.
-	 *	\tparam B
-	 *		The type of \em b.
-	 *
-	 *	\param [in,out] a
-	 *		The safe integer which is on the left hand side.
-	 *	\param [in] b
-	 *		The integer which is on the right hand side.
-	 *
-	 *	\return
-	 *		A reference to \em a.
+	 *	\cond
 	 */
-	template <typename A, typename B>
-	Integer<A> & operator %= (Integer<A> & a, B b) {
 	
-		return a=Arithmetic<A>::Modulus(a.Get(),Integer<A>(b).Get());
+	
+	//	Finds the narrowest standard integer type at least
+	//	as wide as int which can represent the result of an
+	//	operation on A and B, if there is one
+	template <typename Operator, typename A, typename B>
+	class Promotion : public SelectWidth<
+		(Operator::Bits(std::numeric_limits<A>::digits+1,std::numeric_limits<B>::digits+1)+std::numeric_limits<unsigned char>::digits-1)/std::numeric_limits<unsigned char>::digits,
+		int,
+		long,
+		long long
+	> {	};
+	
+	
+	template <typename Operator, typename A, typename B, typename F>
+	constexpr typename std::enable_if<
+		Promotion<Operator,A,B>::Exists,
+		Integer<typename Promotion<Operator,A,B>::Type,Promote<F>>
+	>::type Promoted (A a, B b) noexcept {
+	
+		return Integer<typename Promotion<Operator,A,B>::Type,Promote<F>>(Operator::Apply(
+			static_cast<typename Promotion<Operator,A,B>::Type>(a),
+			static_cast<typename Promotion<Operator,A,B>::Type>(b)
+		));
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b, and assigns the remainder to \em a.
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Adds \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The result is represented by the narrowest type at
+	 *	least as wide as int which can represent every
+	 *	possible result, and is therefore not checked.  If
+	 *	there is no such type \em b is converted to type \em A
+	 *	and the operation is checked.
 	 *
 	 *	\tparam A
 	 *		The integer type of \em a.
+	 *	\tparam F
+	 *		The fallback overflow policy of \em a.
 	 *	\tparam B
 	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
 	 *
-	 *	\param [in,out] a
+	 *	\param [in] a
 	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
 	 *		The safe integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	Integer<A> & operator %= (Integer<A> & a, Integer<B> b) {
+	template <typename A, typename F, typename B, typename P>
+	constexpr auto operator + (Integer<A,Promote<F>> a, Integer<B,P> b) -> decltype(a+b.Get()) {
 	
-		return a%=b.Get();
+		return a+b.Get();
 	
 	}
 	
 	
 	/**
-	 *	Divides \em a by \em b, and assigns the remainder to \em a.
+	 *	Adds \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The result is represented by the narrowest type at
+	 *	least as wide as int which can represent every
+	 *	possible result, and is therefore not checked.  If
+	 *	there is no such type \em b is converted to type \em A
+	 *	and the operation is checked.
 	 *
 	 *	\tparam A
-	 *		The type of \em a.
+	 *		The integer type of \em a.
+	 *	\tparam F
+	 *		The fallback overflow policy of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The type of \em b.
 	 *
-	 *	\param [in,out] a
-	 *		The integer which is on the left hand side.
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side.
+	 *		The integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		A reference to \em a.
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	A & operator %= (A & a, Integer<B> b) {
+	template <typename A, typename F, typename B>
+	constexpr typename std::enable_if<
+		std::is_integral<B>::value && Promotion<AddExpression,A,B>::Exists,
+		decltype(Promoted<AddExpression,A,B,F>(std::declval<A>(),std::declval<B>()))
+	>::type operator + (Integer<A,Promote<F>> a, B b) noexcept {
 	
-		return a=Arithmetic<A>::Modulus(a,b.template Get<A>());
+		return Promoted<AddExpression,A,B,F>(a.Get(),b);
 	
 	}
 	
 	
 	/**
-	 *	Obtains the remainder of division of \em a by \em b.
+	 *	Subtracts \em b from \em a.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The result is represented by the narrowest type at
+	 *	least as wide as int which can represent every
+	 *	possible result, and is therefore not checked.  If
+	 *	there is no such type \em b is converted to type \em A
+	 *	and the operation is checked.
 	 *
 	 *	\tparam A
 	 *		The integer type of \em a.
+	 *	\tparam F
+	 *		The fallback overflow policy of \em a.
 	 *	\tparam B
 	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
 	 *
 	 *	\param [in] a
 	 *		The safe integer which is on the left hand side.
@@ -1651,22 +10120,27 @@ namespace Safe {
 	 *	\return
 	 *		The result.
 	 */
-	template <typename A, typename B>
-	Integer<A> operator % (Integer<A> a, Integer<B> b) {
+	template <typename A, typename F, typename B, typename P>
+	constexpr auto operator - (Integer<A,Promote<F>> a, Integer<B,P> b) -> decltype(a-b.Get()) {
 	
-		return a%=b;
+		return a-b.Get();
 	
 	}
 	
 	
 	/**
-	 *	Obtains the remainder of division of \em a by \em b.
+	 *	Subtracts \em b from \em a.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The result is represented by the narrowest type at
+	 *	least as wide as int which can represent every
+	 *	possible result, and is therefore not checked.  If
+	 *	there is no such type \em b is converted to type \em A
+	 *	and the operation is checked.
 	 *
 	 *	\tparam A
 	 *		The integer type of \em a.
+	 *	\tparam F
+	 *		The fallback overflow policy of \em a.
 	 *	\tparam B
 	 *		The type of \em b.
 	 *
@@ -1678,692 +10152,1312 @@ namespace Safe {
 	 *	\return
 	 *		The result.
 	 */
-	template <typename A, typename B>
-	Integer<A> operator % (Integer<A> a, B b) {
+	template <typename A, typename F, typename B>
+	constexpr typename std::enable_if<
+		std::is_integral<B>::value && Promotion<SubtractExpression,A,B>::Exists,
+		decltype(Promoted<SubtractExpression,A,B,F>(std::declval<A>(),std::declval<B>()))
+	>::type operator - (Integer<A,Promote<F>> a, B b) noexcept {
 	
-		return a%=b;
+		return Promoted<SubtractExpression,A,B,F>(a.Get(),b);
 	
 	}
 	
 	
 	/**
-	 *	Obtains the remainder of division of \em a by \em b.
+	 *	Multiplies \em a and \em b.
 	 *
-	 *	Note that \em b is always converted to type \em A before
-	 *	the operation takes place.
+	 *	The result is represented by the narrowest type at
+	 *	least as wide as int which can represent every
+	 *	possible result, and is therefore not checked.  If
+	 *	there is no such type \em b is converted to type \em A
+	 *	and the operation is checked.
 	 *
 	 *	\tparam A
-	 *		The type of \em a.
+	 *		The integer type of \em a.
+	 *	\tparam F
+	 *		The fallback overflow policy of \em a.
 	 *	\tparam B
 	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
 	 *
 	 *	\param [in] a
-	 *		The integer which is on the left hand side.
+	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
 	 *		The safe integer which is on the right hand side.
 	 *
 	 *	\return
 	 *		The result.
 	 */
-	template <typename A, typename B>
-	Integer<A> operator % (A a, Integer<B> b) {
+	template <typename A, typename F, typename B, typename P>
+	constexpr auto operator * (Integer<A,Promote<F>> a, Integer<B,P> b) -> decltype(a*b.Get()) {
 	
-		return a%=b;
+		return a*b.Get();
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is equal to another
-	 *	safe integer \em b.
+	 *	Multiplies \em a and \em b.
 	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	The result is represented by the narrowest type at
+	 *	least as wide as int which can represent every
+	 *	possible result, and is therefore not checked.  If
+	 *	there is no such type \em b is converted to type \em A
+	 *	and the operation is checked.
 	 *
 	 *	\tparam A
-	 *		The integer type of \em b.
+	 *		The integer type of \em a.
+	 *	\tparam F
+	 *		The fallback overflow policy of \em a.
 	 *	\tparam B
-	 *		The integer type of \em b.
+	 *		The type of \em b.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side
-	 *		of the comparison.
+	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
+	 *		The integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		\em true if \em a is equal to \em b, \em false otherwise. 
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator == (Integer<A> a, Integer<B> b) noexcept {
+	template <typename A, typename F, typename B>
+	constexpr typename std::enable_if<
+		std::is_integral<B>::value && Promotion<MultiplyExpression,A,B>::Exists,
+		decltype(Promoted<MultiplyExpression,A,B,F>(std::declval<A>(),std::declval<B>()))
+	>::type operator * (Integer<A,Promote<F>> a, B b) noexcept {
 	
-		return IsEqual(a.Get(),b.Get());
+		return Promoted<MultiplyExpression,A,B,F>(a.Get(),b);
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is equal to
-	 *	some integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The type of \em b.
+	 *	A range of integers from a first value up to but not
+	 *	including a last value, which may be iterated without
+	 *	checking each step.
 	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side of
-	 *		the comparison.
-	 *	\param [in] b
-	 *		The integer which is on the right hand side of the
-	 *		comparison.
+	 *	When the range is created it's checked that stepping
+	 *	past the last value cannot go out of range, so that
+	 *	iterating cannot overflow.  The range may be used with
+	 *	range-based for loops and standard algorithms.
 	 *
-	 *	\return
-	 *		\em true if \em a is equal to \em b, \em false otherwise. 
+	 *	\tparam T
+	 *		The type of integer.
+	 *	\tparam Policy
+	 *		The overflow policy of the safe integers the
+	 *		range yields, which is also invoked when the step
+	 *		is zero or stepping past the last value would go
+	 *		out of range (in which case, if the policy returns,
+	 *		the range is empty).  Defaults to Safe::Throw.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator == (Integer<A> a, B b) noexcept {
+	template <typename T, typename Policy=Throw>
+	class Range {
+	
+	
+		public:
+		
+		
+			/**
+			 *	The type of integer, converted to unsigned,
+			 *	which is used to count the values.
+			 */
+			typedef typename std::make_unsigned<T>::type UnsignedType;
+			
+			
+			/**
+			 *	Iterates the values of a range.
+			 */
+			class Iterator {
+			
+			
+				private:
+				
+				
+					T value;
+					T step;
+				
+				
+				public:
+				
+				
+					typedef std::random_access_iterator_tag iterator_category;
+					typedef Integer<T,Policy> value_type;
+					typedef std::ptrdiff_t difference_type;
+					typedef void pointer;
+					typedef Integer<T,Policy> reference;
+					
+					
+					constexpr Iterator () noexcept : value(0), step(1) {	}
+					/**
+					 *	Creates an iterator.
+					 *
+					 *	\param [in] value
+					 *		The value the iterator refers to.
+					 *	\param [in] step
+					 *		The difference between successive values.
+					 */
+					constexpr Iterator (T value, T step) noexcept : value(value), step(step) {	}
+					
+					
+					constexpr Integer<T,Policy> operator * () const noexcept {
+					
+						return Integer<T,Policy>(value);
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Integer<T,Policy> operator [] (difference_type n) const noexcept {
+					
+						return *(*this+n);
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Iterator & operator += (difference_type n) noexcept {
+					
+						value=static_cast<T>(static_cast<UnsignedType>(value)+(static_cast<UnsignedType>(n)*static_cast<UnsignedType>(step)));
+						
+						return *this;
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Iterator & operator -= (difference_type n) noexcept {
+					
+						value=static_cast<T>(static_cast<UnsignedType>(value)-(static_cast<UnsignedType>(n)*static_cast<UnsignedType>(step)));
+						
+						return *this;
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Iterator & operator ++ () noexcept {
+					
+						//	The range guarantees this cannot overflow,
+						//	and keeping this plain arithmetic allows
+						//	loops to be vectorized
+						value+=step;
+						
+						return *this;
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Iterator operator ++ (int) noexcept {
+					
+						auto retr=*this;
+						++*this;
+						
+						return retr;
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Iterator & operator -- () noexcept {
+					
+						value-=step;
+						
+						return *this;
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Iterator operator -- (int) noexcept {
+					
+						auto retr=*this;
+						--*this;
+						
+						return retr;
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Iterator operator + (difference_type n) const noexcept {
+					
+						auto retr=*this;
+						
+						return retr+=n;
+					
+					}
+					
+					
+					friend SAFE_CONSTEXPR14 Iterator operator + (difference_type n, Iterator i) noexcept {
+					
+						return i+=n;
+					
+					}
+					
+					
+					SAFE_CONSTEXPR14 Iterator operator - (difference_type n) const noexcept {
+					
+						auto retr=*this;
+						
+						return retr-=n;
+					
+					}
+					
+					
+					constexpr difference_type operator - (Iterator other) const noexcept {
+					
+						//	The distance between values may not be
+						//	representable by T, but is by its unsigned
+						//	counterpart
+						return IsNegative(step)
+							?	static_cast<difference_type>(static_cast<UnsignedType>(static_cast<UnsignedType>(other.value)-static_cast<UnsignedType>(value))/static_cast<UnsignedType>(UnsignedType(0)-static_cast<UnsignedType>(step)))
+							:	static_cast<difference_type>(static_cast<UnsignedType>(static_cast<UnsignedType>(value)-static_cast<UnsignedType>(other.value))/static_cast<UnsignedType>(step));
+					
+					}
+					
+					
+					constexpr bool operator == (Iterator other) const noexcept {
+					
+						return value==other.value;
+					
+					}
+					
+					
+					constexpr bool operator != (Iterator other) const noexcept {
+					
+						return value!=other.value;
+					
+					}
+					
+					
+					constexpr bool operator < (Iterator other) const noexcept {
+					
+						return IsNegative(step) ? (value>other.value) : (value<other.value);
+					
+					}
+					
+					
+					constexpr bool operator > (Iterator other) const noexcept {
+					
+						return other<*this;
+					
+					}
+					
+					
+					constexpr bool operator <= (Iterator other) const noexcept {
+					
+						return !(other<*this);
+					
+					}
+					
+					
+					constexpr bool operator >= (Iterator other) const noexcept {
+					
+						return !(*this<other);
+					
+					}
+			
+			
+			};
+			
+			
+			typedef Iterator iterator;
+			typedef Iterator const_iterator;
+			typedef UnsignedType size_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef Integer<T,Policy> value_type;
+		
+		
+		private:
+		
+		
+			T first;
+			T last;
+			T step;
+			
+			
+			//	Ranges which cannot be iterated are reported to
+			//	the policy, and are empty if it returns
+			static SAFE_CONSTEXPR14 T empty (Direction d, T first, T last, T step) {
+			
+				Policy::Overflow(T(0),d,Operation::Range,first,last,step);
+				
+				return first;
+			
+			}
+			
+			
+			static SAFE_CONSTEXPR14 T get_last (T first, T last, T step) {
+			
+				if (SAFE_UNLIKELY(step==0)) return empty(Direction::Undefined,first,last,step);
+				
+				//	Distances and the magnitude of the step are
+				//	computed as unsigned so that they cannot
+				//	overflow
+				bool negative=IsNegative(step);
+				if (negative ? (last>=first) : (last<=first)) return first;
+				auto distance=negative ? static_cast<UnsignedType>(static_cast<UnsignedType>(first)-static_cast<UnsignedType>(last)) : static_cast<UnsignedType>(static_cast<UnsignedType>(last)-static_cast<UnsignedType>(first));
+				auto magnitude=negative ? static_cast<UnsignedType>(UnsignedType(0)-static_cast<UnsignedType>(step)) : static_cast<UnsignedType>(step);
+				auto count=static_cast<UnsignedType>((distance/magnitude)+(((distance%magnitude)==0) ? 0 : 1));
+				
+				//	The iterator past the last value must be in
+				//	range
+				auto limit=negative
+					?	static_cast<UnsignedType>(static_cast<UnsignedType>(first)-static_cast<UnsignedType>(std::numeric_limits<T>::min()))
+					:	static_cast<UnsignedType>(static_cast<UnsignedType>(std::numeric_limits<T>::max())-static_cast<UnsignedType>(first));
+				UnsignedType offset=0;
+				if (SAFE_UNLIKELY(MultiplyOverflows(count,magnitude,offset) || (offset>limit))) return empty(negative ? Direction::Below : Direction::Above,first,last,step);
+				
+				return static_cast<T>(negative ? (static_cast<UnsignedType>(first)-offset) : (static_cast<UnsignedType>(first)+offset));
+			
+			}
+		
+		
+		public:
+		
+		
+			/**
+			 *	Creates a range from zero up to but not including
+			 *	\em last.
+			 *
+			 *	\param [in] last
+			 *		The end of the range.
+			 */
+			SAFE_CONSTEXPR14 explicit Range (T last) : Range(0,last) {	}
+			/**
+			 *	Creates a range.
+			 *
+			 *	\param [in] first
+			 *		The first value.
+			 *	\param [in] last
+			 *		The end of the range, which is not included.
+			 *	\param [in] step
+			 *		The difference between successive values, which
+			 *		may be negative (in which case \em last must be
+			 *		less than \em first for the range to be
+			 *		non-empty) but not zero.  Defaults to one.
+			 */
+			SAFE_CONSTEXPR14 Range (T first, T last, T step=1) : first(first), last(get_last(first,last,step)), step(step) {	}
+			
+			
+			/**
+			 *	Retrieves an iterator to the first value.
+			 *
+			 *	\return
+			 *		An iterator.
+			 */
+			constexpr Iterator begin () const noexcept {
+			
+				return Iterator(first,step);
+			
+			}
+			
+			
+			/**
+			 *	Retrieves an iterator past the last value.
+			 *
+			 *	\return
+			 *		An iterator.
+			 */
+			constexpr Iterator end () const noexcept {
+			
+				return Iterator(last,step);
+			
+			}
+			
+			
+			/**
+			 *	Retrieves the number of values.
+			 *
+			 *	\return
+			 *		The number of values.
+			 */
+			constexpr UnsignedType size () const noexcept {
+			
+				return static_cast<UnsignedType>(end()-begin());
+			
+			}
+			
+			
+			/**
+			 *	Determines whether there are no values.
+			 *
+			 *	\return
+			 *		\em true if there are no values, \em false
+			 *		otherwise.
+			 */
+			constexpr bool empty () const noexcept {
+			
+				return first==last;
+			
+			}
 	
-		return IsEqual(a.Get(),b);
 	
-	}
+	};
 	
 	
 	/**
-	 *	Determines whether some integer \em a is equal to
-	 *	some safe integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
-	 *
-	 *	\tparam A
-	 *		The type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
-	 *
-	 *	\param [in] a
-	 *		The integer which is on the left hand side of
-	 *		the comparison.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
-	 *
-	 *	\return
-	 *		\em true if \em a is equal to \em b, \em false otherwise. 
+	 *	\cond
 	 */
-	template <typename A, typename B>
-	constexpr bool operator == (A a, Integer<B> b) noexcept {
 	
-		return IsEqual(a,b.Get());
+	
+	template <typename T>
+	constexpr unsigned int FloorLog2 (T i) noexcept {
+	
+		return (i<=1) ? 0 : (1+FloorLog2(static_cast<T>(i/2)));
 	
 	}
 	
 	
-	/**
-	 *	Determines whether some safe integer \em a is not equal to another
-	 *	safe integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The integer type of \em b.
-	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side
-	 *		of the comparison.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
-	 *
-	 *	\return
-	 *		\em true if \em a is not equal to \em b, \em false otherwise. 
-	 */
-	template <typename A, typename B>
-	constexpr bool operator != (Integer<A> a, Integer<B> b) noexcept {
+	//	Divides by an invariant divisor by multiplying by a
+	//	precomputed "magic number" and shifting, the method of
+	//	libdivide's branchfree dividers (which is described by
+	//	Granlund and Montgomery, "Division by Invariant Integers
+	//	using Multiplication")
+	//
+	//	When there's no integer type twice as wide as T the high
+	//	half of the product cannot be computed, so this falls back
+	//	to built in division
+	template <typename T, typename=void>
+	class MagicDivisor {
 	
-		return !(a==b);
 	
-	}
+		private:
+		
+		
+			T d;
+		
+		
+		public:
+		
+		
+			constexpr explicit MagicDivisor (T d) noexcept : d(d) {	}
+			
+			
+			constexpr T Divide (T a) const noexcept {
+			
+				return a/d;
+			
+			}
 	
 	
-	/**
-	 *	Determines whether some safe integer \em a is not equal to
-	 *	some integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The type of \em b.
-	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side of
-	 *		the comparison.
-	 *	\param [in] b
-	 *		The integer which is on the right hand side of the
-	 *		comparison.
-	 *
-	 *	\return
-	 *		\em true if \em a is not equal to \em b, \em false otherwise. 
-	 */
-	template <typename A, typename B>
-	constexpr bool operator != (Integer<A> a, B b) noexcept {
+	};
 	
-		return !(a==b);
 	
-	}
+	template <typename T>
+	class MagicDivisor<T,typename std::enable_if<std::is_unsigned<T>::value && Wider<T>::Exists>::type> {
 	
 	
-	/**
-	 *	Determines whether some integer \em a is not equal to
-	 *	some safe integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
-	 *
-	 *	\tparam A
-	 *		The type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
-	 *
-	 *	\param [in] a
-	 *		The integer which is on the left hand side of
-	 *		the comparison.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
-	 *
-	 *	\return
-	 *		\em true if \em a is not equal to \em b, \em false otherwise. 
-	 */
-	template <typename A, typename B>
-	constexpr bool operator != (A a, Integer<B> b) noexcept {
+		private:
+		
+		
+			typedef typename Wider<T>::Type type;
+			
+			
+			static constexpr unsigned int bits=std::numeric_limits<T>::digits;
+			
+			
+			T magic;
+			unsigned int pre;
+			unsigned int post;
+		
+		
+		public:
+		
+		
+			SAFE_CONSTEXPR14 explicit MagicDivisor (T d) noexcept : magic(0), pre(0), post(0) {
+			
+				//	Dividing by one is the identity, which is the
+				//	result of a zero magic number without shifting
+				if (d==1) return;
+				
+				pre=1;
+				auto log=FloorLog2(d);
+				//	Powers of two are just shifted
+				if ((d&(d-1))==0) {
+				
+					post=log-1;
+					
+					return;
+				
+				}
+				
+				//	The magic number is one more than 2^(N+log+1)/d,
+				//	which is N+1 bits wide, the topmost bit of which
+				//	is accounted for when dividing
+				auto dividend=static_cast<type>(static_cast<type>(1)<<(bits+log));
+				auto m=static_cast<T>(dividend/d);
+				auto rem=static_cast<T>(dividend%d);
+				m=static_cast<T>(m+m);
+				auto twice=static_cast<T>(rem+rem);
+				if ((twice>=d) || (twice<rem)) m=static_cast<T>(m+1);
+				magic=static_cast<T>(m+1);
+				post=log;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 T Divide (T a) const noexcept {
+			
+				auto q=static_cast<T>((static_cast<type>(magic)*static_cast<type>(a))>>bits);
+				
+				return static_cast<T>(static_cast<T>(static_cast<T>(static_cast<T>(a-q)>>pre)+q)>>post);
+			
+			}
 	
-		return !(a==b);
 	
-	}
+	};
+	
+	
+	template <typename T>
+	class MagicDivisor<T,typename std::enable_if<std::is_signed<T>::value && Wider<T>::Exists>::type> {
+	
+	
+		private:
+		
+		
+			typedef typename std::make_unsigned<T>::type unsigned_type;
+			typedef typename Wider<T>::Type type;
+			typedef typename Wider<unsigned_type>::Type unsigned_wide_type;
+			
+			
+			static constexpr unsigned int bits=std::numeric_limits<unsigned_type>::digits;
+			
+			
+			T magic;
+			unsigned int shift;
+			//	All ones if the divisor is negative, zero otherwise
+			unsigned_type sign;
+		
+		
+		public:
+		
+		
+			SAFE_CONSTEXPR14 explicit MagicDivisor (T d) noexcept : magic(0), shift(0), sign((d<0) ? static_cast<unsigned_type>(~unsigned_type(0)) : unsigned_type(0)) {
+			
+				auto abs=(d<0) ? static_cast<unsigned_type>(unsigned_type(0)-static_cast<unsigned_type>(d)) : static_cast<unsigned_type>(d);
+				shift=FloorLog2(abs);
+				//	Powers of two are just shifted
+				if ((abs&(abs-1))==0) return;
+				
+				//	The magnitude of the divisor is used, and the
+				//	quotient negated if the divisor is negative
+				auto dividend=static_cast<unsigned_wide_type>(static_cast<unsigned_wide_type>(1)<<(bits+shift-1));
+				auto m=static_cast<unsigned_type>(dividend/abs);
+				auto rem=static_cast<unsigned_type>(dividend%abs);
+				m=static_cast<unsigned_type>(m+m);
+				auto twice=static_cast<unsigned_type>(rem+rem);
+				if ((twice>=abs) || (twice<rem)) m=static_cast<unsigned_type>(m+1);
+				magic=static_cast<T>(static_cast<unsigned_type>(m+1));
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 T Divide (T a) const noexcept {
+			
+				auto q=static_cast<T>((static_cast<type>(magic)*static_cast<type>(a))>>bits);
+				q=static_cast<T>(static_cast<unsigned_type>(static_cast<unsigned_type>(q)+static_cast<unsigned_type>(a)));
+				//	Negative quotients are rounded toward zero by
+				//	adding one less than the divisor before shifting
+				//	(which is 2^shift-1 for powers of two and 2^shift
+				//	otherwise)
+				auto round=static_cast<unsigned_type>(static_cast<unsigned_type>(unsigned_type(1)<<shift)-((magic==0) ? 1U : 0U));
+				q=static_cast<T>(static_cast<unsigned_type>(static_cast<unsigned_type>(q)+(static_cast<unsigned_type>(q>>(bits-1))&round)));
+				q=static_cast<T>(q>>shift);
+				
+				return static_cast<T>(static_cast<unsigned_type>((static_cast<unsigned_type>(q)^sign)-sign));
+			
+			}
+	
+	
+	};
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is greater than
-	 *	another safe integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The integer type of \em b.
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	A divisor which is checked once, when it's created, and
+	 *	which thereafter divides at the cost of a multiplication
+	 *	and some shifts, rather than a division.
 	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side
-	 *		of the comparison.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
+	 *	Dividing by the same divisor many times is much faster
+	 *	this way.  When there's no integer type twice as wide as
+	 *	\em T built in division is used, though it's still only
+	 *	checked once.
 	 *
-	 *	\return
-	 *		\em true if \em a is greater than \em b, \em false otherwise. 
+	 *	\tparam T
+	 *		The integer type of the divisor.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator > (Integer<A> a, Integer<B> b) noexcept {
+	template <typename T>
+	class Divisor {
+	
+	
+		private:
+		
+		
+			T d;
+			MagicDivisor<T> magic;
+			
+			
+			static SAFE_CONSTEXPR14 T check (T d) {
+			
+				//	Dividing the smallest value by negative one
+				//	overflows, since that's the only division
+				//	which is ever checked it's simply forbidden
+				if (SAFE_UNLIKELY((d==0) || (IsNegative(d) && (d==static_cast<T>(-1))))) Raise<T>(Operation::Divide,d);
+				
+				return d;
+			
+			}
+		
+		
+		public:
+		
+		
+			/**
+			 *	Creates a divisor.
+			 *
+			 *	If \em d is zero, or negative one, Safe::OverflowError
+			 *	is thrown.
+			 *
+			 *	\param [in] d
+			 *		The divisor.
+			 */
+			SAFE_CONSTEXPR14 explicit Divisor (T d) : d(check(d)), magic(d) {	}
+			
+			
+			/**
+			 *	Retrieves the divisor.
+			 *
+			 *	\return
+			 *		The divisor.
+			 */
+			constexpr T Get () const noexcept {
+			
+				return d;
+			
+			}
+			
+			
+			/**
+			 *	Divides an integer by this divisor.
+			 *
+			 *	\param [in] a
+			 *		The dividend.
+			 *
+			 *	\return
+			 *		The quotient, rounded toward zero as built in
+			 *		division does.
+			 */
+			SAFE_CONSTEXPR14 T Divide (T a) const noexcept {
+			
+				return magic.Divide(a);
+			
+			}
+			
+			
+			/**
+			 *	Finds the remainder of dividing an integer by this
+			 *	divisor.
+			 *
+			 *	\param [in] a
+			 *		The dividend.
+			 *
+			 *	\return
+			 *		The remainder, which has the sign of \em a as
+			 *		the remainder of built in division does.
+			 */
+			SAFE_CONSTEXPR14 T Modulus (T a) const noexcept {
+			
+				typedef typename std::make_unsigned<T>::type type;
+				
+				return static_cast<T>(static_cast<type>(static_cast<type>(a)-static_cast<type>(static_cast<type>(Divide(a))*static_cast<type>(d))));
+			
+			}
 	
-		return Compare(a.Get(),b.Get())>0;
 	
-	}
+	};
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is greater than
-	 *	some integer \em b.
+	 *	Divides \em a by \em b.
 	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Since \em b was checked when it was created, this
+	 *	never overflows.
 	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The type of \em b.
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side of
-	 *		the comparison.
+	 *		The safe integer which is the dividend.
 	 *	\param [in] b
-	 *		The integer which is on the right hand side of the
-	 *		comparison.
+	 *		The divisor.
 	 *
 	 *	\return
-	 *		\em true if \em a is greater than \em b, \em false otherwise. 
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator > (Integer<A> a, B b) noexcept {
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> operator / (Integer<T,P> a, Divisor<T> b) noexcept {
 	
-		return Compare(a.Get(),b)>0;
+		return b.Divide(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some integer \em a is greater than
-	 *	some safe integer \em b.
+	 *	Finds the remainder of dividing \em a by \em b.
 	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Since \em b was checked when it was created, this
+	 *	never overflows.
 	 *
-	 *	\tparam A
-	 *		The type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
 	 *
 	 *	\param [in] a
-	 *		The integer which is on the left hand side of
-	 *		the comparison.
+	 *		The safe integer which is the dividend.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
+	 *		The divisor.
 	 *
 	 *	\return
-	 *		\em true if \em a is greater than \em b, \em false otherwise. 
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator > (A a, Integer<B> b) noexcept {
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> operator % (Integer<T,P> a, Divisor<T> b) noexcept {
 	
-		return Compare(a,b.Get())>0;
+		return b.Modulus(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is greater than
-	 *	or equal to another safe integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Divides \em a by \em b, and assigns the result of the
+	 *	division to \em a.
 	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The integer type of \em b.
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
 	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side
-	 *		of the comparison.
+	 *	\param [in,out] a
+	 *		The safe integer which is the dividend.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
+	 *		The divisor.
 	 *
 	 *	\return
-	 *		\em true if \em a is greater than or equal to \em b, \em false
-	 *		otherwise. 
+	 *		A reference to \em a.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator >= (Integer<A> a, Integer<B> b) noexcept {
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator /= (Integer<T,P> & a, Divisor<T> b) noexcept {
 	
-		return Compare(a.Get(),b.Get())>=0;
+		return a=b.Divide(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is greater than
-	 *	or equal to some integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Finds the remainder of dividing \em a by \em b, and
+	 *	assigns the result to \em a.
 	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The type of \em b.
+	 *	\tparam T
+	 *		The integer type of \em a and \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
 	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side of
-	 *		the comparison.
+	 *	\param [in,out] a
+	 *		The safe integer which is the dividend.
 	 *	\param [in] b
-	 *		The integer which is on the right hand side of the
-	 *		comparison.
+	 *		The divisor.
 	 *
 	 *	\return
-	 *		\em true if \em a is greater than or equal to \em b, \em false
-	 *		otherwise. 
+	 *		A reference to \em a.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator >= (Integer<A> a, B b) noexcept {
+	template <typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> & operator %= (Integer<T,P> & a, Divisor<T> b) noexcept {
 	
-		return Compare(a.Get(),b)>=0;
+		return a=b.Modulus(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some integer \em a is greater than
-	 *	or equal to some safe integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
-	 *
-	 *	\tparam A
-	 *		The type of \em a.
-	 *	\tparam B
-	 *		The integer type of \em b.
+	 *	A compile time constant which may be used as an operand
+	 *	of arithmetic with a safe integer, in which case the
+	 *	overflow check is reduced to comparing against a bound
+	 *	computed at compile time.
 	 *
-	 *	\param [in] a
-	 *		The integer which is on the left hand side of
-	 *		the comparison.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
+	 *	Any std::integral_constant may be used the same way.
 	 *
-	 *	\return
-	 *		\em true if \em a is greater than or equal to \em b, \em false
-	 *		otherwise. 
+	 *	\tparam N
+	 *		The value.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator >= (A a, Integer<B> b) noexcept {
-	
-		return Compare(a,b.Get())>=0;
-	
-	}
+	template <std::intmax_t N>
+	using Constant=std::integral_constant<std::intmax_t,N>;
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is less than
-	 *	another safe integer \em b.
-	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
-	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The integer type of \em b.
-	 *
-	 *	\param [in] a
-	 *		The safe integer which is on the left hand side
-	 *		of the comparison.
-	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
-	 *
-	 *	\return
-	 *		\em true if \em a is less than \em b, \em false otherwise. 
+	 *	\cond
 	 */
-	template <typename A, typename B>
-	constexpr bool operator < (Integer<A> a, Integer<B> b) noexcept {
 	
-		return Compare(a.Get(),b.Get())<0;
 	
-	}
+	//	Arithmetic with a compile time constant, where every
+	//	branch on the constant is resolved at compile time and
+	//	at most one comparison remains
+	template <typename T, typename Policy, typename U, U N>
+	class ConstantArithmetic {
+	
+	
+		private:
+		
+		
+			typedef typename std::make_unsigned<T>::type type;
+			typedef std::numeric_limits<T> limits;
+			
+			
+			static_assert(InRange<T>(N),"Constant is out of range");
+			
+			
+			//	Bounds are computed wrapping (and division by zero
+			//	and negative one is avoided), so that the bounds
+			//	which are discarded for a given constant don't
+			//	overflow
+			static constexpr T add (T a, T b) noexcept {
+			
+				return static_cast<T>(static_cast<type>(static_cast<type>(a)+static_cast<type>(b)));
+			
+			}
+			
+			
+			static constexpr T subtract (T a, T b) noexcept {
+			
+				return static_cast<T>(static_cast<type>(static_cast<type>(a)-static_cast<type>(b)));
+			
+			}
+			
+			
+			static constexpr T multiply (T a, T b) noexcept {
+			
+				return static_cast<T>(static_cast<type>(static_cast<type>(a)*static_cast<type>(b)));
+			
+			}
+			
+			
+			static constexpr bool is_minus_one (T b) noexcept {
+			
+				return IsNegative(b) && (b==static_cast<T>(-1));
+			
+			}
+			
+			
+			static constexpr T divide (T a, T b) noexcept {
+			
+				return ((b==0) || is_minus_one(b)) ? a : static_cast<T>(a/b);
+			
+			}
+		
+		
+		public:
+		
+		
+			SAFE_CONSTEXPR14 static T Add (T a) {
+			
+				constexpr T n=static_cast<T>(N);
+				constexpr T lower=IsNegative(n) ? subtract(limits::min(),n) : limits::min();
+				constexpr T upper=IsNegative(n) ? limits::max() : subtract(limits::max(),n);
+				
+				auto r=add(a,n);
+				if (SAFE_UNLIKELY(a<lower)) return Policy::Overflow(r,Direction::Below,Operation::Add,a,n);
+				if (SAFE_UNLIKELY(a>upper)) return Policy::Overflow(r,Direction::Above,Operation::Add,a,n);
+				
+				return r;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Subtract (T a) {
+			
+				constexpr T n=static_cast<T>(N);
+				constexpr T lower=IsNegative(n) ? limits::min() : add(limits::min(),n);
+				constexpr T upper=IsNegative(n) ? add(limits::max(),n) : limits::max();
+				
+				auto r=subtract(a,n);
+				if (SAFE_UNLIKELY(a<lower)) return Policy::Overflow(r,Direction::Below,Operation::Subtract,a,n);
+				if (SAFE_UNLIKELY(a>upper)) return Policy::Overflow(r,Direction::Above,Operation::Subtract,a,n);
+				
+				return r;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Multiply (T a) {
+			
+				constexpr T n=static_cast<T>(N);
+				constexpr bool negative=IsNegative(n);
+				//	Multiplying by zero or one never overflows, and
+				//	multiplying by negative one only overflows for
+				//	the smallest value
+				constexpr bool trivial=(n==0) || (n==1);
+				constexpr T lower=trivial ? limits::min() : (is_minus_one(n) ? add(limits::min(),1) : divide(negative ? limits::max() : limits::min(),n));
+				constexpr T upper=trivial ? limits::max() : (is_minus_one(n) ? limits::max() : divide(negative ? limits::min() : limits::max(),n));
+				
+				//	Both bounds are checked with a single unsigned
+				//	comparison of the distance from the lower bound,
+				//	and multiplying by a negative number reverses the
+				//	direction
+				auto r=multiply(a,n);
+				if (SAFE_UNLIKELY(static_cast<type>(subtract(a,lower))>static_cast<type>(subtract(upper,lower)))) return Policy::Overflow(
+					r,
+					((a<lower)!=negative) ? Direction::Below : Direction::Above,
+					Operation::Multiply,
+					a,
+					n
+				);
+				
+				return r;
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Divide (T a) {
+			
+				static_assert(N!=0,"Division by zero");
+				
+				constexpr T n=static_cast<T>(N);
+				//	Only the smallest value divided by negative
+				//	one overflows
+				if (is_minus_one(n)) {
+				
+					if (SAFE_UNLIKELY(a==limits::min())) return Policy::Overflow(a,Direction::Above,Operation::Divide,a,n);
+					
+					return subtract(0,a);
+				
+				}
+				
+				//	Division by a constant (which for powers of two
+				//	is just a shift) is left to the compiler
+				return static_cast<T>(a/n);
+			
+			}
+			
+			
+			SAFE_CONSTEXPR14 static T Modulus (T a) noexcept {
+			
+				static_assert(N!=0,"Division by zero");
+				
+				constexpr T n=static_cast<T>(N);
+				//	The remainder of dividing by negative one is
+				//	always zero, but computing it for the smallest
+				//	value is undefined
+				if (is_minus_one(n)) return 0;
+				
+				return static_cast<T>(a%n);
+			
+			}
+	
+	
+	};
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is less than
-	 *	some integer \em b.
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	Adds \em b to \em a.
 	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Since \em b is known at compile time, at most one
+	 *	comparison is performed to check the result.
 	 *
-	 *	\tparam A
+	 *	\tparam T
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam U
 	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The type of \em b.
+	 *	\tparam N
+	 *		The value of \em b, which must be representable
+	 *		by \em T.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side of
-	 *		the comparison.
+	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The integer which is on the right hand side of the
-	 *		comparison.
+	 *		The constant which is on the right hand side.
 	 *
 	 *	\return
-	 *		\em true if \em a is less than \em b, \em false otherwise. 
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator < (Integer<A> a, B b) noexcept {
+	template <typename T, typename P, typename U, U N>
+	SAFE_CONSTEXPR14 Integer<T,P> operator + (Integer<T,P> a, std::integral_constant<U,N>) {
 	
-		return Compare(a.Get(),b)<0;
+		return ConstantArithmetic<T,P,U,N>::Add(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some integer \em a is less than
-	 *	some safe integer \em b.
+	 *	Subtracts \em b from \em a.
 	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Since \em b is known at compile time, at most one
+	 *	comparison is performed to check the result.
 	 *
-	 *	\tparam A
-	 *		The type of \em a.
-	 *	\tparam B
+	 *	\tparam T
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam U
 	 *		The integer type of \em b.
+	 *	\tparam N
+	 *		The value of \em b, which must be representable
+	 *		by \em T.
 	 *
 	 *	\param [in] a
-	 *		The integer which is on the left hand side of
-	 *		the comparison.
+	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
+	 *		The constant which is on the right hand side.
 	 *
 	 *	\return
-	 *		\em true if \em a is less than \em b, \em false otherwise. 
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator < (A a, Integer<B> b) noexcept {
+	template <typename T, typename P, typename U, U N>
+	SAFE_CONSTEXPR14 Integer<T,P> operator - (Integer<T,P> a, std::integral_constant<U,N>) {
 	
-		return Compare(a,b.Get())<0;
+		return ConstantArithmetic<T,P,U,N>::Subtract(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is less than
-	 *	or equal to another safe integer \em b.
+	 *	Multiplies \em a by \em b.
 	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Since \em b is known at compile time, at most one
+	 *	comparison is performed to check the result.
 	 *
-	 *	\tparam A
-	 *		The integer type of \em b.
-	 *	\tparam B
+	 *	\tparam T
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam U
 	 *		The integer type of \em b.
+	 *	\tparam N
+	 *		The value of \em b, which must be representable
+	 *		by \em T.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side
-	 *		of the comparison.
+	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
+	 *		The constant which is on the right hand side.
 	 *
 	 *	\return
-	 *		\em true if \em a is less than or equal to \em b, \em false
-	 *		otherwise. 
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator <= (Integer<A> a, Integer<B> b) noexcept {
+	template <typename T, typename P, typename U, U N>
+	SAFE_CONSTEXPR14 Integer<T,P> operator * (Integer<T,P> a, std::integral_constant<U,N>) {
 	
-		return Compare(a.Get(),b.Get())<=0;
+		return ConstantArithmetic<T,P,U,N>::Multiply(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some safe integer \em a is less than
-	 *	or equal to some integer \em b.
+	 *	Divides \em a by \em b.
 	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Dividing by zero is a compile error.
 	 *
-	 *	\tparam A
+	 *	Since \em b is known at compile time, at most one
+	 *	comparison is performed to check the result.
+	 *
+	 *	\tparam T
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam U
 	 *		The integer type of \em b.
-	 *	\tparam B
-	 *		The type of \em b.
+	 *	\tparam N
+	 *		The value of \em b, which must be representable
+	 *		by \em T.
 	 *
 	 *	\param [in] a
-	 *		The safe integer which is on the left hand side of
-	 *		the comparison.
+	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The integer which is on the right hand side of the
-	 *		comparison.
+	 *		The constant which is on the right hand side.
 	 *
 	 *	\return
-	 *		\em true if \em a is less than or equal to \em b, \em false
-	 *		otherwise. 
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator <= (Integer<A> a, B b) noexcept {
+	template <typename T, typename P, typename U, U N>
+	SAFE_CONSTEXPR14 Integer<T,P> operator / (Integer<T,P> a, std::integral_constant<U,N>) {
 	
-		return Compare(a.Get(),b)<=0;
+		return ConstantArithmetic<T,P,U,N>::Divide(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Determines whether some integer \em a is less than
-	 *	or equal to some safe integer \em b.
+	 *	Finds the remainder of dividing \em a by \em b.
 	 *
-	 *	Comparing integers of different width and signedness
-	 *	using this operator results in well-defined and mathematically
-	 *	correct results.
+	 *	Dividing by zero is a compile error.
 	 *
-	 *	\tparam A
-	 *		The type of \em a.
-	 *	\tparam B
+	 *	Since \em b is known at compile time, at most one
+	 *	comparison is performed to check the result.
+	 *
+	 *	\tparam T
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam U
 	 *		The integer type of \em b.
+	 *	\tparam N
+	 *		The value of \em b, which must be representable
+	 *		by \em T.
 	 *
 	 *	\param [in] a
-	 *		The integer which is on the left hand side of
-	 *		the comparison.
+	 *		The safe integer which is on the left hand side.
 	 *	\param [in] b
-	 *		The safe integer which is on the right hand side
-	 *		of the comparison.
+	 *		The constant which is on the right hand side.
 	 *
 	 *	\return
-	 *		\em true if \em a is less than or equal to \em b, \em false
-	 *		otherwise. 
+	 *		The result.
 	 */
-	template <typename A, typename B>
-	constexpr bool operator <= (A a, Integer<B> b) noexcept {
+	template <typename T, typename P, typename U, U N>
+	SAFE_CONSTEXPR14 Integer<T,P> operator % (Integer<T,P> a, std::integral_constant<U,N>) {
 	
-		return Compare(a,b.Get())<=0;
+		return ConstantArithmetic<T,P,U,N>::Modulus(a.Get());
 	
 	}
 	
 	
 	/**
-	 *	Applies unary plus to a safe integer.
+	 *	Adds \em b to \em a.
 	 *
+	 *	Since \em a is known at compile time, at most one
+	 *	comparison is performed to check the result.
+	 *
+	 *	\tparam U
+	 *		The integer type of \em a.
+	 *	\tparam N
+	 *		The value of \em a, which must be representable
+	 *		by \em T.
 	 *	\tparam T
-	 *		The integer type of the safe integer type.
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
 	 *
 	 *	\param [in] a
-	 *		The safe integer.
+	 *		The constant which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		\em a.
+	 *		The result.
 	 */
-	template <typename T>
-	constexpr Integer<T> operator + (Integer<T> a) noexcept {
+	template <typename U, U N, typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> operator + (std::integral_constant<U,N>, Integer<T,P> b) {
 	
-		return a;
+		return ConstantArithmetic<T,P,U,N>::Add(b.Get());
 	
 	}
 	
 	
 	/**
-	 *	Applies unary minus to a safe integer.
+	 *	Multiplies \em a by \em b.
 	 *
-	 *	This overload activates when the safe integer
-	 *	type-in-question is unsigned.  In this case
-	 *	an exception is thrown unless the safe
-	 *	integer-in-question is exactly zero.
+	 *	Since \em a is known at compile time, at most one
+	 *	comparison is performed to check the result.
 	 *
+	 *	\tparam U
+	 *		The integer type of \em a.
+	 *	\tparam N
+	 *		The value of \em a, which must be representable
+	 *		by \em T.
 	 *	\tparam T
-	 *		The integer type of the safe integer type.
+	 *		The integer type of \em b.
+	 *	\tparam P
+	 *		The overflow policy of \em b.
 	 *
 	 *	\param [in] a
-	 *		The safe integer.
+	 *		The constant which is on the left hand side.
+	 *	\param [in] b
+	 *		The safe integer which is on the right hand side.
 	 *
 	 *	\return
-	 *		Zero.
+	 *		The result.
 	 */
-	template <typename T>
-	typename std::enable_if<Integer<T>::Unsigned,Integer<T>>::type operator - (Integer<T> a) {
+	template <typename U, U N, typename T, typename P>
+	SAFE_CONSTEXPR14 Integer<T,P> operator * (std::integral_constant<U,N>, Integer<T,P> b) {
 	
-		if (a==0) return a;
-		
-		Raise();
+		return ConstantArithmetic<T,P,U,N>::Multiply(b.Get());
 	
 	}
 	
 	
 	/**
-	 *	Applies unary minus to a safe integer.
+	 *	Shifts \em a left by \em b bits.
 	 *
-	 *	This overload activates when the safe integer
-	 *	type-in-question is signed.
+	 *	Since \em b is known at compile time, it being out
+	 *	of range is a compile error
+	 *	and whether bits are lost is checked with a single
+	 *	comparison.
 	 *
 	 *	\tparam T
-	 *		The integer type of the safe integer type.
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam U
+	 *		The integer type of \em b.
+	 *	\tparam N
+	 *		The value of \em b, which must be non-negative
+	 *		and less than the number of bits in \em T.
 	 *
 	 *	\param [in] a
-	 *		The safe integer.
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The constant which is on the right hand side.
 	 *
 	 *	\return
-	 *		The result of multiplying \em a by negative
-	 *		one.
+	 *		The result.
 	 */
-	template <typename T>
-	typename std::enable_if<Integer<T>::Signed,Integer<T>>::type operator - (Integer<T> a) {
+	template <typename T, typename P, typename U, U N>
+	SAFE_CONSTEXPR14 Integer<T,P> operator << (Integer<T,P> a, std::integral_constant<U,N>) {
 	
-		return a*-1;
+		static_assert(!IsNegative(N) && (static_cast<typename std::make_unsigned<U>::type>(N)<std::numeric_limits<typename std::make_unsigned<T>::type>::digits),"Shift count out of range");
+		
+		return Shift<T,P>::Left(a.Get(),N);
 	
 	}
 	
 	
 	/**
-	 *	Creates a safe integer by wrapping an integer.
+	 *	Shifts \em a right by \em b bits.
+	 *
+	 *	Since \em b is known at compile time, it being out
+	 *	of range is a compile error,
+	 *	and only whether \em a is negative is checked.
 	 *
 	 *	\tparam T
-	 *		The type of integer to wrap.
+	 *		The integer type of \em a.
+	 *	\tparam P
+	 *		The overflow policy of \em a.
+	 *	\tparam U
+	 *		The integer type of \em b.
+	 *	\tparam N
+	 *		The value of \em b, which must be non-negative
+	 *		and less than the number of bits in \em T.
 	 *
-	 *	\param [in] i
-	 *		An integer of type \em T.
+	 *	\param [in] a
+	 *		The safe integer which is on the left hand side.
+	 *	\param [in] b
+	 *		The constant which is on the right hand side.
 	 *
 	 *	\return
-	 *		A safe integer which wraps \em i.
+	 *		The result.
 	 */
-	template <typename T>
-	Integer<T> Make (T i) noexcept {
+	template <typename T, typename P, typename U, U N>
+	SAFE_CONSTEXPR14 Integer<T,P> operator >> (Integer<T,P> a, std::integral_constant<U,N>) {
 	
-		return Integer<T>(i);
+		static_assert(!IsNegative(N) && (static_cast<typename std::make_unsigned<U>::type>(N)<std::numeric_limits<typename std::make_unsigned<T>::type>::digits),"Shift count out of range");
+		
+		return Shift<T,P>::Right(a.Get(),N);
 	
 	}
 	
@@ -2400,6 +11494,255 @@ namespace Safe {
 	typedef Integer<std::ptrdiff_t> ssize_t;
 
 
+	/**
+	 *	\cond
+	 */
+	
+	
+	constexpr unsigned long long LiteralDigit (char c) noexcept {
+	
+		return ((c>='0') && (c<='9')) ? static_cast<unsigned long long>(c-'0') : (
+			((c>='a') && (c<='f')) ? static_cast<unsigned long long>(c-'a'+10) : static_cast<unsigned long long>(c-'A'+10)
+		);
+	
+	}
+	
+	
+	//	Parses the characters of an integer literal in Base,
+	//	noting whether its value cannot be represented by an
+	//	unsigned long long
+	template <unsigned long long Base, unsigned long long Accumulated, bool Overflow, char... Cs>
+	class LiteralValue {
+	
+	
+		public:
+		
+		
+			static constexpr unsigned long long Value=Accumulated;
+			static constexpr bool Overflowed=Overflow;
+	
+	
+	};
+	
+	
+	template <unsigned long long Base, unsigned long long Accumulated, bool Overflow, char C, char... Cs>
+	class LiteralValue<Base,Accumulated,Overflow,C,Cs...> : public LiteralValue<
+		Base,
+		Accumulated*Base+LiteralDigit(C),
+		Overflow || (Accumulated>((std::numeric_limits<unsigned long long>::max()-LiteralDigit(C))/Base)),
+		Cs...
+	> {	};
+	
+	
+	//	Digit separators
+	template <unsigned long long Base, unsigned long long Accumulated, bool Overflow, char... Cs>
+	class LiteralValue<Base,Accumulated,Overflow,'\'',Cs...> : public LiteralValue<Base,Accumulated,Overflow,Cs...> {	};
+	
+	
+	template <char... Cs>
+	class Literal : public LiteralValue<10,0,false,Cs...> {	};
+	
+	
+	template <char... Cs>
+	class Literal<'0',Cs...> : public LiteralValue<8,0,false,Cs...> {	};
+	
+	
+	template <char... Cs>
+	class Literal<'0','x',Cs...> : public LiteralValue<16,0,false,Cs...> {	};
+	
+	
+	template <char... Cs>
+	class Literal<'0','X',Cs...> : public LiteralValue<16,0,false,Cs...> {	};
+	
+	
+	template <char... Cs>
+	class Literal<'0','b',Cs...> : public LiteralValue<2,0,false,Cs...> {	};
+	
+	
+	template <char... Cs>
+	class Literal<'0','B',Cs...> : public LiteralValue<2,0,false,Cs...> {	};
+	
+	
+	template <typename T, char... Cs>
+	constexpr Integer<T> MakeLiteral () noexcept {
+	
+		static_assert(!Literal<Cs...>::Overflowed && InRange<T>(Literal<Cs...>::Value),"Literal out of range");
+		
+		return Integer<T>(static_cast<T>(Literal<Cs...>::Value));
+	
+	}
+	
+	
+	/**
+	 *	\endcond
+	 */
+	
+	
+	/**
+	 *	User defined literals which create safe integers.
+	 *
+	 *	Literals which are out of range of the type are
+	 *	rejected at compile time.  Note that negative
+	 *	literals are the negation of a positive literal, so
+	 *	the smallest value of a signed type cannot be written
+	 *	as a literal.
+	 */
+	namespace Literals {
+	
+	
+		/**
+		 *	Creates a safe integer wrapping an 8 bit signed integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::int8_t> operator""_i8 () noexcept {
+		
+			return MakeLiteral<std::int8_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping a 16 bit signed integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::int16_t> operator""_i16 () noexcept {
+		
+			return MakeLiteral<std::int16_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping a 32 bit signed integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::int32_t> operator""_i32 () noexcept {
+		
+			return MakeLiteral<std::int32_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping a 64 bit signed integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::int64_t> operator""_i64 () noexcept {
+		
+			return MakeLiteral<std::int64_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping an 8 bit unsigned integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::uint8_t> operator""_u8 () noexcept {
+		
+			return MakeLiteral<std::uint8_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping a 16 bit unsigned integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::uint16_t> operator""_u16 () noexcept {
+		
+			return MakeLiteral<std::uint16_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping a 32 bit unsigned integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::uint32_t> operator""_u32 () noexcept {
+		
+			return MakeLiteral<std::uint32_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping a 64 bit unsigned integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::uint64_t> operator""_u64 () noexcept {
+		
+			return MakeLiteral<std::uint64_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping a std::size_t integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::size_t> operator""_sz () noexcept {
+		
+			return MakeLiteral<std::size_t,Cs...>();
+		
+		}
+		
+		
+		/**
+		 *	Creates a safe integer wrapping a std::ptrdiff_t integer
+		 *	from a literal, which must be in range.
+		 *
+		 *	\return
+		 *		A safe integer.
+		 */
+		template <char... Cs>
+		constexpr Integer<std::ptrdiff_t> operator""_pd () noexcept {
+		
+			return MakeLiteral<std::ptrdiff_t,Cs...>();
+		
+		}
+	
+	
+	}
+
+
 }
 
 
@@ -2411,14 +11754,14 @@ namespace Safe {
 namespace std {
 
 
-	template <typename T>
-	struct hash<Safe::Integer<T>> {
+	template <typename T, typename P>
+	struct hash<Safe::Integer<T,P>> {
 	
 	
 		public:
 		
 		
-			size_t operator () (const Safe::Integer<T> & i) const noexcept {
+			size_t operator () (const Safe::Integer<T,P> & i) const noexcept {
 			
 				return hash<T>{}(i.Get());
 			
@@ -2428,14 +11771,51 @@ namespace std {
 	};
 	
 	
-	template <typename T>
-	class numeric_limits<Safe::Integer<T>> : public numeric_limits<T> {
+	template <typename T, T Lo, T Hi>
+	class numeric_limits<Safe::Bounded<T,Lo,Hi>> : public numeric_limits<T> {
+	
+	
+		private:
+		
+		
+			typedef Safe::Bounded<T,Lo,Hi> type;
+		
+		
+		public:
+		
+		
+			static constexpr type min () noexcept {
+			
+				return type(Lo,Safe::Unchecked());
+			
+			}
+			
+			
+			static constexpr type lowest () noexcept {
+			
+				return type(Lo,Safe::Unchecked());
+			
+			}
+			
+			
+			static constexpr type max () noexcept {
+			
+				return type(Hi,Safe::Unchecked());
+			
+			}
+	
+	
+	};
+	
+	
+	template <typename T, typename P>
+	class numeric_limits<Safe::Integer<T,P>> : public numeric_limits<T> {
 	
 	
 		private:
 		
 		
-			typedef Safe::Integer<T> type;
+			typedef Safe::Integer<T,P> type;
 			typedef numeric_limits<T> base;
 	
 	
@@ -2508,35 +11888,35 @@ namespace std {
 	};
 	
 	
-	template <typename T>
-	struct is_signed<Safe::Integer<T>> : public is_signed<T> {	};
+	template <typename T, typename P>
+	struct is_signed<Safe::Integer<T,P>> : public is_signed<T> {	};
 	
 	
-	template <typename T>
-	struct is_unsigned<Safe::Integer<T>> : public is_unsigned<T> {	};
+	template <typename T, typename P>
+	struct is_unsigned<Safe::Integer<T,P>> : public is_unsigned<T> {	};
 	
 	
-	template <typename T>
-	struct make_signed<Safe::Integer<T>> {
+	template <typename T, typename P>
+	struct make_signed<Safe::Integer<T,P>> {
 	
 	
 		public:
 		
 		
-			typedef Safe::Integer<typename make_signed<T>::type> type;
+			typedef Safe::Integer<typename make_signed<T>::type,P> type;
 	
 	
 	};
 	
 	
-	template <typename T>
-	struct make_unsigned<Safe::Integer<T>> {
+	template <typename T, typename P>
+	struct make_unsigned<Safe::Integer<T,P>> {
 	
 	
 		public:
 		
 		
-			typedef Safe::Integer<typename make_unsigned<T>::type> type;
+			typedef Safe::Integer<typename make_unsigned<T>::type,P> type;
 	
 	
 	};
@@ -0,0 +1,247 @@
+//	Checks that safe integer arithmetic may be evaluated at
+//	compile time, and that overflow during constant
+//	evaluation prevents the expression from being constant
+//
+//	Requires C++14, and is only compiled, never run
+
+
+#include <safe/safe.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+
+using Safe::Cast;
+using Safe::Integer;
+
+
+namespace {
+
+
+	//	Detects whether F::Value() is a constant expression
+	template <int>
+	class Constant {	};
+	
+	
+	template <typename F>
+	constexpr bool IsConstant (decltype(Constant<(F::Value(),0)>()) *) {
+	
+		return true;
+	
+	}
+	
+	
+	template <typename F>
+	constexpr bool IsConstant (...) {
+	
+		return false;
+	
+	}
+	
+	
+	constexpr int max=std::numeric_limits<int>::max();
+	constexpr int min=std::numeric_limits<int>::min();
+	
+	
+	constexpr Integer<std::size_t> stride (std::size_t width, std::size_t bytes) {
+	
+		Integer<std::size_t> retr(width);
+		retr*=bytes;
+		retr+=15;
+		retr/=16;
+		
+		return retr*16;
+	
+	}
+
+
+}
+
+
+//	Arithmetic
+static_assert((Integer<int>(2)+3)==5,"Addition is not constant");
+static_assert((Integer<int>(2)-3)==-1,"Subtraction is not constant");
+static_assert((Integer<int>(-4)*3)==-12,"Multiplication is not constant");
+static_assert((Integer<int>(7)/2)==3,"Division is not constant");
+static_assert((Integer<int>(7)%2)==1,"Modulus is not constant");
+static_assert((2+Integer<unsigned int>(3))==5U,"Addition is not constant");
+static_assert((Integer<long>(2)*Integer<short>(3))==6,"Multiplication is not constant");
+static_assert(-Integer<int>(2)==-2,"Unary minus is not constant");
+static_assert(Integer<int>(-2).UnsignedAbs()==2U,"UnsignedAbs is not constant");
+static_assert(Integer<int>(-2).Abs()==2,"Abs is not constant");
+static_assert(stride(100,3)==304U,"Compound assignment is not constant");
+static_assert(Safe::MulAdd(Integer<int>(100),4,5)==405,"MulAdd is not constant");
+static_assert(Safe::MulAdd(Integer<std::int8_t,Safe::Saturate>(2),100,-300)==-100,"MulAdd of out of range operands is not constant");
+static_assert(Safe::MulSub(std::int8_t(16),std::int8_t(8),std::int8_t(1))==127,"MulSub is not constant");
+static_assert(Safe::Sum(1,2,Integer<short>(3))==6,"Sum is not constant");
+static_assert(Safe::Product(2,3U,Integer<int>(4))==24,"Product is not constant");
+static_assert(Safe::Sum(Integer<std::int8_t,Safe::Saturate>(100),1000,-1000)==100,"Sum of out of range integers is not constant");
+static_assert(Safe::MulDiv<Safe::Rounding::Nearest>(Integer<int>(7),1,2)==4,"MulDiv is not constant");
+static_assert(Safe::MulDiv(Integer<std::int8_t,Safe::Saturate>(100),3,-300)==-1,"MulDiv of out of range operands is not constant");
+static_assert((Integer<int>(-100)/Safe::Divisor<int>(7))==-14,"Division by a Divisor is not constant");
+static_assert((Integer<unsigned int>(100)%Safe::Divisor<unsigned int>(7))==2U,"Modulus by a Divisor is not constant");
+static_assert((Integer<int>(5)*Safe::Constant<8>())==40,"Arithmetic with a Constant is not constant");
+static_assert((Safe::Constant<3>()+Integer<int>(5))==8,"Arithmetic with a Constant is not constant");
+static_assert(Safe::Pow(Integer<long long>(10),18)==1000000000000000000LL,"Pow is not constant");
+static_assert(Safe::ISqrt(Safe::size_t(1000000))==1000U,"ISqrt is not constant");
+static_assert((Safe::ILog2(1024)==10) && (Safe::ILog10(1000U)==3U),"Logarithms are not constant");
+static_assert((Safe::BitWidth(255)==8) && (Safe::PopCount(255)==8),"Bit counts are not constant");
+#if defined(SAFE_INT128) && !defined(__STRICT_ANSI__)
+static_assert((Safe::BitWidth(Integer<Safe::UInt128>(Safe::UInt128(1)<<100))==101) && (Safe::ILog10(Integer<Safe::UInt128>(~Safe::UInt128(0)))==38),"128 bit bit counts are not constant");
+#endif
+static_assert(((Safe::Make(1) << 30)==(1 << 30)) && ((Safe::Make(96) >> Safe::Constant<5>())==3),"Shifts are not constant");
+static_assert(((Safe::Make(0xF0U) & 0x3C)==0x30) && (~Safe::Make(0U)==~0U),"Bitwise operations are not constant");
+static_assert((Safe::Midpoint(-5,10U)==2) && (Safe::AbsDiff(-5,10U)==15) && (Safe::Distance(10U,-5)==-15),"Midpoints and differences are not constant");
+static_assert((Safe::AlignUp(13U,8)==16U) && (Safe::DivCeil(13,4)==4) && (Safe::RoundUpToMultiple(13,12)==24),"Alignment and rounding are not constant");
+static_assert(Safe::DivFloor(Integer<std::uint8_t,Safe::Saturate>(10),-3)==0U,"Division by an out of range divisor is not constant");
+
+
+//	Conversions
+static_assert(Cast<std::uint8_t>(255)==255U,"Cast is not constant");
+static_assert(Integer<std::uint8_t>(200)==200,"Conversion is not constant");
+static_assert(Integer<int>(300).Get<short>()==300,"Conversion is not constant");
+static_assert(Safe::Make(5).MakeUnsigned()==5U,"Conversion is not constant");
+
+
+//	Overflow policies which do not throw may be evaluated
+static_assert((Integer<int,Safe::Saturate>(max)+1)==max,"Saturation is not constant");
+static_assert((Integer<int,Safe::Wrap>(max)+1)==min,"Wrapping is not constant");
+static_assert(Integer<std::uint8_t,Safe::Saturate>(-1)==0,"Saturation is not constant");
+
+
+//	Overflow when throwing is not a constant expression
+namespace {
+
+
+	class Sum {
+	
+	
+		public:
+		
+		
+			static constexpr int Value () {
+			
+				return (Integer<int>(max)+1).Get();
+			
+			}
+	
+	
+	};
+	
+	
+	class Product {
+	
+	
+		public:
+		
+		
+			static constexpr int Value () {
+			
+				return (Integer<int>(max/2)*3).Get();
+			
+			}
+	
+	
+	};
+	
+	
+	class Quotient {
+	
+	
+		public:
+		
+		
+			static constexpr int Value () {
+			
+				return (Integer<int>(1)/0).Get();
+			
+			}
+	
+	
+	};
+	
+	
+	class Narrowing {
+	
+	
+		public:
+		
+		
+			static constexpr int Value () {
+			
+				return Cast<std::uint8_t>(256);
+			
+			}
+	
+	
+	};
+	
+	
+	class Power {
+	
+	
+		public:
+		
+		
+			static constexpr int Value () {
+			
+				return Safe::Pow(10,10).Get();
+			
+			}
+	
+	
+	};
+	
+	
+	class ShiftLeft {
+	
+	
+		public:
+		
+		
+			static constexpr int Value () {
+			
+				return (Safe::Make(1) << 31).Get();
+			
+			}
+	
+	
+	};
+	
+	
+	class InRange {
+	
+	
+		public:
+		
+		
+			static constexpr int Value () {
+			
+				return (Integer<int>(max-1)+1).Get();
+			
+			}
+	
+	
+	};
+
+
+}
+
+
+static_assert(!IsConstant<Sum>(nullptr),"Overflowing addition is constant");
+static_assert(!IsConstant<Product>(nullptr),"Overflowing multiplication is constant");
+static_assert(!IsConstant<Quotient>(nullptr),"Division by zero is constant");
+static_assert(!IsConstant<Narrowing>(nullptr),"Narrowing conversion is constant");
+static_assert(!IsConstant<Power>(nullptr),"Overflowing exponentiation is constant");
+static_assert(!IsConstant<ShiftLeft>(nullptr),"Overflowing shift is constant");
+static_assert(IsConstant<InRange>(nullptr),"Addition is not constant");
+
+
+//	Literals
+using namespace Safe::Literals;
+
+
+static_assert(300_u16==300,"Literal is not constant");
+static_assert(0b1111'1111_u8==255,"Literal is not constant");
+static_assert(0xFF'FF_u16==65535,"Literal is not constant");
+static_assert((200_u8+55)==255,"Literal is not constant");
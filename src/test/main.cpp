@@ -28,9 +28,11 @@ namespace Catch {
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <numeric>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 
 using Safe::Cast;
@@ -3115,6 +3117,94 @@ SCENARIO("Safe integers may be safely subtracted") {
 }
 
 
+SCENARIO("Safe integers of any width may be added and subtracted up to the limits of their range") {
+
+	GIVEN("An 8 bit unsigned safe integer") {
+	
+		typedef std::uint8_t type;
+		typedef std::numeric_limits<type> limits;
+		
+		THEN("It may be added to or subtracted from such that the result is at the limits of its range") {
+		
+			CHECK((Integer<type>(limits::max()-1)+type(1))==limits::max());
+			CHECK((Integer<type>(1)-type(1))==0);
+		
+		}
+		
+		THEN("Adding to or subtracting from it such that the result is just beyond the limits of its range throws") {
+		
+			REQUIRE_THROWS_AS(Integer<type>(limits::max())+type(1),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(0)-type(1),std::overflow_error);
+		
+		}
+	
+	}
+	
+	GIVEN("An 8 bit signed safe integer") {
+	
+		typedef std::int8_t type;
+		typedef std::numeric_limits<type> limits;
+		
+		THEN("It may be added to or subtracted from such that the result is at the limits of its range") {
+		
+			CHECK((Integer<type>(limits::max()-1)+type(1))==limits::max());
+			CHECK((Integer<type>(limits::min()+1)+type(-1))==limits::min());
+			CHECK((Integer<type>(-1)-limits::max())==limits::min());
+			CHECK((Integer<type>(-1)-limits::min())==limits::max());
+		
+		}
+		
+		THEN("Adding to or subtracting from it such that the result is just beyond the limits of its range throws") {
+		
+			REQUIRE_THROWS_AS(Integer<type>(limits::max())+type(1),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(limits::min())+type(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(0)-limits::min(),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(-2)-limits::max(),std::overflow_error);
+		
+		}
+	
+	}
+	
+	GIVEN("A 64 bit unsigned safe integer") {
+	
+		typedef std::uint64_t type;
+		typedef std::numeric_limits<type> limits;
+		
+		THEN("Adding to or subtracting from it such that the result is just beyond the limits of its range throws") {
+		
+			REQUIRE_THROWS_AS(Integer<type>(limits::max())+type(1),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(limits::max()/2+1)+(limits::max()/2+1),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(1)-type(2),std::overflow_error);
+		
+		}
+	
+	}
+	
+	GIVEN("A 64 bit signed safe integer") {
+	
+		typedef std::int64_t type;
+		typedef std::numeric_limits<type> limits;
+		
+		THEN("It may be added to or subtracted from such that the result is at the limits of its range") {
+		
+			CHECK((Integer<type>(limits::max())+limits::min())==-1);
+			CHECK((Integer<type>(limits::min())-type(-1))==(limits::min()+1));
+		
+		}
+		
+		THEN("Adding to or subtracting from it such that the result is just beyond the limits of its range throws") {
+		
+			REQUIRE_THROWS_AS(Integer<type>(limits::min())+limits::min(),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(limits::max())-type(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(limits::min())-type(1),std::overflow_error);
+		
+		}
+	
+	}
+
+}
+
+
 SCENARIO("Safe integers may be safely decremented") {
 
 	GIVEN("A safe integer which is not the minimum value") {
@@ -3504,7 +3594,7 @@ SCENARIO("Safe integers may be safely multiplied") {
 		
 			THEN("An exception is thrown") {
 			
-				REQUIRE_THROWS_AS(s*=(std::numeric_limits<int>::max()/2)+1,std::overflow_error);
+				REQUIRE_THROWS_AS(s*=(std::numeric_limits<int>::max()/2)+2,std::overflow_error);
 				
 			}
 		
@@ -3548,7 +3638,7 @@ SCENARIO("Safe integers may be safely multiplied") {
 		
 			THEN("An exception is thrown") {
 			
-				REQUIRE_THROWS_AS(s*=static_cast<unsigned int>((std::numeric_limits<int>::max()/2)+1),std::overflow_error);
+				REQUIRE_THROWS_AS(s*=static_cast<unsigned int>((std::numeric_limits<int>::max()/2)+2),std::overflow_error);
 			
 			}
 		
@@ -3559,6 +3649,99 @@ SCENARIO("Safe integers may be safely multiplied") {
 }
 
 
+SCENARIO("Safe integers of any width may be multiplied up to the limits of their range") {
+
+	GIVEN("An 8 bit unsigned safe integer") {
+	
+		typedef std::uint8_t type;
+		typedef std::numeric_limits<type> limits;
+		
+		Integer<type> s(limits::max()/2);
+		
+		THEN("It may be multiplied such that the result is the largest representable value") {
+		
+			CHECK((s*type(2))==(limits::max()-1));
+			CHECK((Integer<type>(limits::max())*type(1))==limits::max());
+		
+		}
+		
+		THEN("Multiplying it such that the result is one more than the largest representable value throws") {
+		
+			REQUIRE_THROWS_AS(Integer<type>(16)*type(16),std::overflow_error);
+		
+		}
+	
+	}
+	
+	GIVEN("An 8 bit signed safe integer") {
+	
+		typedef std::int8_t type;
+		typedef std::numeric_limits<type> limits;
+		
+		THEN("It may be multiplied such that the result is the smallest representable value") {
+		
+			CHECK((Integer<type>(limits::min()/2)*type(2))==limits::min());
+			CHECK((Integer<type>(limits::min())*type(1))==limits::min());
+			CHECK((Integer<type>(limits::min()/-2)*type(-2))==limits::min());
+		
+		}
+		
+		THEN("Multiplying the smallest representable value by negative one throws") {
+		
+			REQUIRE_THROWS_AS(Integer<type>(limits::min())*type(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(-1)*limits::min(),std::overflow_error);
+		
+		}
+	
+	}
+	
+	GIVEN("A 64 bit unsigned safe integer") {
+	
+		typedef std::uint64_t type;
+		typedef std::numeric_limits<type> limits;
+		
+		THEN("It may be multiplied such that the result is the largest representable value") {
+		
+			CHECK((Integer<type>(0xFFFFFFFFULL)*type(0x100000001ULL))==limits::max());
+		
+		}
+		
+		THEN("Multiplying it such that the result overflows throws") {
+		
+			REQUIRE_THROWS_AS(Integer<type>(0x100000000ULL)*type(0x100000000ULL),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(limits::max())*type(2),std::overflow_error);
+		
+		}
+	
+	}
+	
+	GIVEN("A 64 bit signed safe integer") {
+	
+		typedef std::int64_t type;
+		typedef std::numeric_limits<type> limits;
+		
+		THEN("It may be multiplied such that the result is the smallest or largest representable value") {
+		
+			CHECK((Integer<type>(limits::min()/2)*type(2))==limits::min());
+			CHECK((Integer<type>(limits::max())*type(-1))==-limits::max());
+			CHECK((Integer<type>(-limits::max())*type(-1))==limits::max());
+		
+		}
+		
+		THEN("Multiplying it such that the result overflows throws") {
+		
+			REQUIRE_THROWS_AS(Integer<type>(limits::min())*type(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(limits::max()/2+1)*type(2),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(limits::min()/2-1)*type(2),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<type>(limits::min()/2)*type(-2),std::overflow_error);
+		
+		}
+	
+	}
+
+}
+
+
 SCENARIO("Safe integers may be multiplied and multiply-assigned by other safe integers, or integers, either on the right or the left") {
 
 	GIVEN("A safe integer") {
@@ -5084,3 +5267,2098 @@ SCENARIO("Safe integer types may be converted to signed or unsigned") {
 	}
 
 }
+
+
+SCENARIO("Overflows are reported by throwing an exception which describes the operation") {
+
+	GIVEN("A signed safe integer which contains the largest value") {
+	
+		typedef std::int32_t type;
+		
+		Integer<type> i(std::numeric_limits<type>::max());
+		
+		WHEN("One is added to it") {
+		
+			THEN("The exception thrown describes the addition") {
+			
+				try {
+				
+					i+=1;
+					FAIL("No exception was thrown");
+				
+				} catch (const Safe::OverflowError & ex) {
+				
+					CHECK(ex.GetOperation()==Safe::Operation::Add);
+					CHECK(ex.Width()==32);
+					CHECK(ex.Signed());
+					REQUIRE(ex.OperandCount()==2);
+					CHECK(ex.GetOperand(0).Get()==0x7FFFFFFFU);
+					CHECK(ex.GetOperand(1).Get()==1);
+					CHECK(std::string(ex.what())=="Integer value out of range (add of 2147483647 and 1 in 32 bit signed)");
+				
+				}
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("A negative signed integer") {
+	
+		std::int16_t i=-5;
+		
+		WHEN("It is cast to an unsigned type") {
+		
+			THEN("The exception thrown describes the cast") {
+			
+				try {
+				
+					Cast<std::uint8_t>(i);
+					FAIL("No exception was thrown");
+				
+				} catch (const Safe::OverflowError & ex) {
+				
+					CHECK(ex.GetOperation()==Safe::Operation::Cast);
+					CHECK(ex.Width()==8);
+					CHECK_FALSE(ex.Signed());
+					REQUIRE(ex.OperandCount()==1);
+					CHECK(ex.GetOperand(0).Get()==0xFFFBU);
+					CHECK(ex.GetOperand(0).Width()==16);
+					CHECK(ex.GetOperand(0).Signed());
+					CHECK(std::string(ex.what())=="Integer value out of range (cast of -5 in 8 bit unsigned)");
+				
+				}
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("A safe integer") {
+	
+		Integer<unsigned int> i(5);
+		
+		WHEN("It is divided by zero") {
+		
+			THEN("The exception thrown is a std::overflow_error which describes the division") {
+			
+				try {
+				
+					i/=0U;
+					FAIL("No exception was thrown");
+				
+				} catch (const std::overflow_error & ex) {
+				
+					CHECK(std::string(ex.what())=="Integer value out of range (divide of 5 and 0 in 32 bit unsigned)");
+				
+				}
+			
+			}
+		
+		}
+		
+		WHEN("The exception thrown is copied") {
+		
+			THEN("The copy describes the same operation") {
+			
+				try {
+				
+					i-=6U;
+					FAIL("No exception was thrown");
+				
+				} catch (const Safe::OverflowError & ex) {
+				
+					auto message=ex.what();
+					Safe::OverflowError copy(ex);
+					CHECK(std::string(copy.what())=="Integer value out of range (subtract of 5 and 6 in 32 bit unsigned)");
+					copy=Safe::OverflowError(Safe::Operation::Negate,8,true,Safe::OverflowError::Operand(std::int8_t(-128)));
+					CHECK(std::string(copy.what())=="Integer value out of range (negate of -128 in 8 bit signed)");
+					CHECK(ex.what()==message);
+				
+				}
+			
+			}
+		
+		}
+	
+	}
+
+}
+
+
+static std::size_t overflows=0;
+
+
+static void count_overflow (const Safe::OverflowError &) noexcept {
+
+	++overflows;
+
+}
+
+
+SCENARIO("Safe integers may have an overflow policy other than throwing") {
+
+	GIVEN("A saturating signed safe integer") {
+	
+		typedef Integer<std::int8_t,Safe::Saturate> type;
+		typedef std::numeric_limits<std::int8_t> limits;
+		
+		THEN("Operations which go above its range yield the largest value") {
+		
+			CHECK((type(limits::max())+1)==limits::max());
+			CHECK((type(limits::min())-limits::max())==limits::min());
+			CHECK((type(limits::max())-(-1))==limits::max());
+			CHECK((type(64)*2)==limits::max());
+			CHECK((type(limits::min())*-1)==limits::max());
+			CHECK((type(limits::min())/-1)==limits::max());
+			CHECK((type(5)/0)==limits::max());
+			CHECK(type(limits::min()).Abs()==limits::max());
+			CHECK(type(300)==limits::max());
+		
+		}
+		
+		THEN("Operations which go below its range yield the smallest value") {
+		
+			CHECK((type(limits::min())+(-1))==limits::min());
+			CHECK((type(64)*-3)==limits::min());
+			CHECK((type(-5)/0)==limits::min());
+			CHECK(type(-300)==limits::min());
+		
+		}
+		
+		THEN("Operations which are undefined yield zero") {
+		
+			CHECK((type(0)/0)==0);
+			CHECK((type(5)%0)==0);
+			CHECK((type(limits::min())%-1)==0);
+		
+		}
+	
+	}
+	
+	GIVEN("A saturating unsigned safe integer") {
+	
+		typedef Integer<unsigned int,Safe::Saturate> type;
+		typedef std::numeric_limits<unsigned int> limits;
+		
+		type i(1);
+		
+		THEN("Operations which go out of range saturate") {
+		
+			CHECK((i-2U)==0);
+			CHECK((i+limits::max())==limits::max());
+			CHECK(-i==0);
+			CHECK(type(-1)==0);
+			CHECK((Cast<std::uint8_t,Safe::Saturate>(-1)==0));
+			CHECK((Cast<std::uint8_t,Safe::Saturate>(256)==255));
+		
+		}
+		
+		THEN("Converting it to a type which cannot represent its value saturates") {
+		
+			CHECK(type(limits::max()).Get<std::int16_t>()==std::numeric_limits<std::int16_t>::max());
+			CHECK(type(limits::max()).MakeSigned()==std::numeric_limits<int>::max());
+		
+		}
+	
+	}
+	
+	GIVEN("A wrapping signed safe integer") {
+	
+		typedef Integer<int,Safe::Wrap> type;
+		typedef std::numeric_limits<int> limits;
+		
+		THEN("Operations which go out of range wrap") {
+		
+			CHECK((type(limits::max())+1)==limits::min());
+			CHECK((type(limits::min())-1)==limits::max());
+			CHECK((type(limits::min())*-1)==limits::min());
+			CHECK((type(limits::min())/-1)==limits::min());
+			CHECK((type(5)/0)==0);
+			CHECK(type(0x100000000LL)==0);
+		
+		}
+		
+		THEN("Operations which do not go out of range are unaffected") {
+		
+			CHECK((type(2)+3)==5);
+			CHECK((type(2)-3)==-1);
+		
+		}
+	
+	}
+	
+	GIVEN("A saturating or wrapping safe integer and an integer which is out of its range") {
+	
+		typedef Integer<std::int8_t,Safe::Saturate> stype;
+		typedef Integer<std::uint8_t,Safe::Saturate> utype;
+		typedef Integer<std::int8_t,Safe::Wrap> wtype;
+		
+		THEN("Only the result of an operation between them saturates or wraps") {
+		
+			CHECK((stype(100)-300)==-128);
+			CHECK((stype(-100)*1000)==-128);
+			CHECK((utype(10)+(-5))==5);
+			CHECK((utype(10)-(-5))==15);
+			CHECK((utype(10)*-5)==0);
+			CHECK((wtype(100)+1000)==76);
+			CHECK((wtype(100)/1000)==0);
+			CHECK((wtype(100)%1000)==100);
+			CHECK((wtype(-100)%1000)==-100);
+			CHECK((Integer<std::uint8_t,Safe::Wrap>(10)/-5)==254);
+		
+		}
+		
+		THEN("Only the result of compound assignment to an integer saturates") {
+		
+			int i=5;
+			i+=Integer<long long,Safe::Saturate>(1LL << 40);
+			CHECK(i==std::numeric_limits<int>::max());
+			i-=Integer<long long,Safe::Saturate>((1LL << 40)+1);
+			CHECK(i==std::numeric_limits<int>::min());
+		
+		}
+	
+	}
+	
+	GIVEN("A safe integer with a callback policy") {
+	
+		typedef Integer<unsigned int,Safe::Callback<count_overflow>> type;
+		
+		overflows=0;
+		type i;
+		
+		WHEN("An operation does not go out of range") {
+		
+			i+=1U;
+			
+			THEN("The callback is not invoked") {
+			
+				CHECK(overflows==0);
+				CHECK(i==1);
+			
+			}
+		
+		}
+		
+		WHEN("An operation goes out of range") {
+		
+			i-=1U;
+			
+			THEN("The callback is invoked and the result is saturated") {
+			
+				CHECK(overflows==1);
+				CHECK(i==0);
+			
+			}
+		
+		}
+		
+		WHEN("The right hand side of an operation is out of range but the result is not") {
+		
+			i=1U;
+			i+=-1;
+			
+			THEN("The callback is not invoked") {
+			
+				CHECK(overflows==0);
+				CHECK(i==0);
+			
+			}
+		
+		}
+		
+		WHEN("The right hand side of an operation is out of range and its fallback throws") {
+		
+			Integer<unsigned int,Safe::Callback<count_overflow,Safe::Throw>> t(1U);
+			
+			THEN("The callback is invoked and the right hand side is reported") {
+			
+				REQUIRE_THROWS_AS(t+=-1,std::overflow_error);
+				CHECK(overflows==1);
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("A safe integer with a non-throwing policy") {
+	
+		THEN("Operations on it do not throw") {
+		
+			CHECK(noexcept(Integer<std::int8_t,Safe::Saturate>(300)));
+			CHECK(noexcept(Integer<int,Safe::Wrap>().Get<short>()));
+			CHECK_FALSE(noexcept(Integer<std::int8_t>(300)));
+		
+		}
+	
+	}
+	
+	GIVEN("A throwing safe integer and a saturating safe integer") {
+	
+		Integer<int> a(std::numeric_limits<int>::max());
+		Integer<int,Safe::Saturate> b(1);
+		
+		THEN("Operations take the policy of the left hand side") {
+		
+			REQUIRE_THROWS_AS(a+b,std::overflow_error);
+			CHECK((b+a)==std::numeric_limits<int>::max());
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Arithmetic may be performed without throwing by inspecting the result") {
+
+	GIVEN("Operations which remain in range") {
+	
+		THEN("The result holds the value and indicates success") {
+		
+			auto r=Safe::TryAdd(2,3);
+			CHECK(r);
+			CHECK_FALSE(r.Overflowed());
+			CHECK(r.Get()==5);
+			CHECK(Safe::TrySubtract(Safe::Make(2U),1).Get()==1U);
+			CHECK(Safe::TryMultiply(-4,Safe::Make(3)).Get()==-12);
+			CHECK(Safe::TryDivide(7,2).Get()==3);
+			CHECK(Safe::TryModulus(7,2).Get()==1);
+			CHECK(Safe::TryCast<std::uint8_t>(255).Get()==255);
+		
+		}
+	
+	}
+	
+	GIVEN("Operations which go out of range") {
+	
+		THEN("The result holds the wrapped value and indicates overflow") {
+		
+			auto r=Safe::TryAdd(std::numeric_limits<int>::max(),1);
+			CHECK_FALSE(r);
+			CHECK(r.Overflowed());
+			CHECK(r.Get()==std::numeric_limits<int>::min());
+			CHECK(Safe::TrySubtract(0U,1).Get()==std::numeric_limits<unsigned int>::max());
+			CHECK(Safe::TryMultiply(std::numeric_limits<std::uint8_t>::max(),2).Overflowed());
+			CHECK(Safe::TryAdd(std::uint8_t(0),256).Overflowed());
+			CHECK(Safe::TryAdd(0U,-1).Overflowed());
+			CHECK(Safe::TryDivide(1,0).Overflowed());
+			CHECK(Safe::TryDivide(std::numeric_limits<int>::min(),-1).Overflowed());
+			CHECK(Safe::TryModulus(1,0).Overflowed());
+			CHECK(Safe::TryCast<std::uint8_t>(-1).Overflowed());
+			CHECK(Safe::TryCast<std::uint8_t>(-1).Get()==255);
+		
+		}
+	
+	}
+	
+	GIVEN("A result") {
+	
+		THEN("It is trivially copyable and never throws") {
+		
+			CHECK(std::is_trivially_copyable<Safe::Result<int>>::value);
+			CHECK(noexcept(Safe::TryAdd(1,1)));
+			CHECK(noexcept(Safe::TryCast<short>(Safe::Make(1))));
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Checked integers defer checking until their value is retrieved") {
+
+	GIVEN("An expression which remains in range") {
+	
+		Safe::Checked<std::size_t> base(16U);
+		std::size_t count=4;
+		int stride=8;
+		
+		WHEN("It is evaluated") {
+		
+			auto offset=base+count*Safe::Checked<std::size_t>(stride)+2;
+			
+			THEN("The value may be retrieved") {
+			
+				CHECK_FALSE(offset.Overflowed());
+				CHECK(offset.Get()==50U);
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("An expression part of which goes out of range") {
+	
+		Safe::Checked<int> a(std::numeric_limits<int>::max());
+		
+		WHEN("It is evaluated") {
+		
+			auto b=(a+1)-2;
+			
+			THEN("The overflow propagates and is reported when the value is retrieved") {
+			
+				CHECK(b.Overflowed());
+				REQUIRE_THROWS_AS(b.Get(),std::overflow_error);
+				CHECK(Safe::Checked<long long>(b).Overflowed());
+				CHECK((1+b).Overflowed());
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("Operations which go out of range") {
+	
+		THEN("The result has overflowed") {
+		
+			CHECK((Safe::Checked<int>(1)/0).Overflowed());
+			CHECK((Safe::Checked<int>(1)%0).Overflowed());
+			CHECK((Safe::Checked<int>(std::numeric_limits<int>::min())/-1).Overflowed());
+			CHECK((Safe::Checked<unsigned int>(0U)-1).Overflowed());
+			CHECK((Safe::Checked<unsigned int>(0U)+(-1)).Overflowed());
+			CHECK(Safe::Checked<std::uint8_t>(256).Overflowed());
+			CHECK(Safe::Checked<std::uint8_t>(Safe::Checked<int>(-1)).Overflowed());
+			CHECK(Safe::Checked<int>(Safe::TryAdd(std::numeric_limits<int>::max(),1)).Overflowed());
+		
+		}
+	
+	}
+	
+	GIVEN("A checked integer which overflowed with a saturating policy") {
+	
+		Safe::Checked<std::uint8_t,Safe::Saturate> a(200);
+		a*=2;
+		
+		THEN("Retrieving it does not throw") {
+		
+			CHECK(noexcept(a.Get()));
+			CHECK(a.Overflowed());
+		
+		}
+		
+		THEN("Its value saturates in the direction it went out of range") {
+		
+			CHECK(a.Get()==255);
+			CHECK((Safe::Checked<std::int32_t,Safe::Saturate>(2000000000)+2000000000).Get()==std::numeric_limits<std::int32_t>::max());
+			CHECK((Safe::Checked<std::int32_t,Safe::Saturate>(-2000000000)-2000000000).Get()==std::numeric_limits<std::int32_t>::min());
+			CHECK((Safe::Checked<std::int32_t,Safe::Saturate>(-5)/0).Get()==std::numeric_limits<std::int32_t>::min());
+			CHECK((Safe::Checked<std::int32_t,Safe::Saturate>(5)%0).Get()==0);
+			CHECK((Safe::Checked<std::uint8_t,Safe::Saturate>(-1).Get()==0));
+		
+		}
+		
+		THEN("Its value keeps saturating in that direction while later operations move it further that way") {
+		
+			Safe::Checked<int,Safe::Saturate> c(std::numeric_limits<int>::max());
+			c+=1;
+			c*=2;
+			c+=5;
+			CHECK(c.Get()==std::numeric_limits<int>::max());
+		
+		}
+		
+		THEN("The direction is forgotten once a later operation may have reversed it") {
+		
+			Safe::Checked<int,Safe::Saturate> c(std::numeric_limits<int>::max());
+			c+=1;
+			c*=-1;
+			CHECK(c.Overflowed());
+			CHECK(c.Get()==0);
+			Safe::Checked<int,Safe::Saturate> d(std::numeric_limits<int>::max());
+			d+=1;
+			d-=1;
+			CHECK(d.Get()==0);
+			Safe::Checked<std::int8_t,Safe::Saturate> e(-1000);
+			e+=Safe::Checked<std::int8_t>(1000);
+			CHECK(e.Get()==0);
+		
+		}
+	
+	}
+	
+	GIVEN("A checked integer which overflowed with a wrapping policy") {
+	
+		Safe::Checked<std::uint8_t,Safe::Wrap> a(200);
+		a*=2;
+		
+		THEN("Its value wraps") {
+		
+			CHECK(a.Get()==144);
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Bounded integers propagate their bounds at compile time") {
+
+	GIVEN("Two bounded integers") {
+	
+		Safe::Bounded<std::uint8_t,0,64> channels(48);
+		Safe::Bounded<std::uint8_t,0,100> percent(100);
+		
+		WHEN("They are multiplied") {
+		
+			auto r=channels*percent;
+			
+			THEN("The result has the bounds of the product and a type wide enough to represent them") {
+			
+				CHECK(r.Get()==4800U);
+				CHECK((std::is_same<decltype(r),Safe::Bounded<unsigned int,0,6400>>::value));
+				CHECK(noexcept(channels*percent));
+			
+			}
+		
+		}
+		
+		WHEN("One is subtracted from the other") {
+		
+			auto r=channels-percent;
+			
+			THEN("The result is signed") {
+			
+				CHECK(r.Get()==-52);
+				CHECK((std::is_same<decltype(r),Safe::Bounded<int,-100,64>>::value));
+			
+			}
+		
+		}
+		
+		WHEN("They are added and the sum fits the left hand side") {
+		
+			auto r=channels+Safe::Bounded<std::uint8_t,0,10>(5);
+			
+			THEN("The type of the left hand side is retained") {
+			
+				CHECK(r.Get()==53U);
+				CHECK((std::is_same<decltype(r),Safe::Bounded<std::uint8_t,0,74>>::value));
+			
+			}
+		
+		}
+		
+		WHEN("They are divided and the remainder found") {
+		
+			Safe::Bounded<int,-7,-2> d(-5);
+			auto q=percent/d;
+			auto m=Safe::Bounded<int,-100,100>(-99)%d;
+			
+			THEN("The bounds are correct") {
+			
+				CHECK(q.Get()==-20);
+				CHECK((std::is_same<decltype(q),Safe::Bounded<int,-50,0>>::value));
+				CHECK(m.Get()==-4);
+				CHECK((std::is_same<decltype(m),Safe::Bounded<int,-6,6>>::value));
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("Values which may be out of range") {
+	
+		THEN("Conversion to a bounded integer is checked") {
+		
+			typedef Safe::Bounded<int,0,100> percent;
+			REQUIRE_THROWS_AS(percent(101),std::overflow_error);
+			REQUIRE_THROWS_AS(percent(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(percent(Safe::Make(200U)),std::overflow_error);
+			REQUIRE_THROWS_AS(percent(Safe::Bounded<long,50,150>(120)),std::overflow_error);
+			CHECK(percent(Safe::Bounded<long,50,150>(70)).Get()==70);
+			CHECK(noexcept(percent(Safe::Bounded<std::uint8_t,0,64>())));
+			CHECK_FALSE(noexcept(percent(Safe::Bounded<long,50,150>(70))));
+		
+		}
+	
+	}
+	
+	GIVEN("A bounded integer and a safe integer") {
+	
+		Safe::Bounded<int,0,300> a(300);
+		Integer<std::uint8_t> b(1);
+		
+		THEN("They may be mixed and narrowing is checked") {
+		
+			CHECK((a+Safe::Make(1)).Get()==301);
+			CHECK((a+1)==301);
+			CHECK(Integer<int>(a)==300);
+			REQUIRE_THROWS_AS(b+a,std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Cast<std::uint8_t>(a),std::overflow_error);
+			CHECK(Safe::Cast<short>(a)==300);
+			CHECK(noexcept(Safe::Cast<short>(a)));
+			CHECK_FALSE(noexcept(Safe::Cast<std::uint8_t>(a)));
+			CHECK((Safe::Cast<std::uint8_t,Safe::Saturate>(a)==255));
+			CHECK((std::numeric_limits<Safe::Bounded<int,0,300>>::max().Get()==300));
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Expressions may be evaluated lazily and checked once") {
+
+	GIVEN("An expression whose intermediate results are out of range") {
+	
+		Integer<int> a(std::numeric_limits<int>::max());
+		Integer<int> b(2);
+		int c=std::numeric_limits<int>::max();
+		
+		WHEN("It is evaluated lazily") {
+		
+			auto e=Safe::Lazy(a)*b-Safe::Lazy(c)*b+1;
+			
+			THEN("The result is correct") {
+			
+				CHECK(e.Get<int>()==1);
+				CHECK(Safe::Cast<short>(e)==1);
+				Integer<int> r=e;
+				CHECK(r==1);
+			
+			}
+		
+		}
+		
+		WHEN("Its result is out of range") {
+		
+			auto e=Safe::Lazy(a)*b;
+			
+			THEN("Converting it invokes the policy") {
+			
+				REQUIRE_THROWS_AS(e.Get<int>(),std::overflow_error);
+				REQUIRE_THROWS_AS(Integer<int>(e),std::overflow_error);
+				CHECK(e.Get<long long>()==2LL*std::numeric_limits<int>::max());
+				CHECK((e.Get<int,Safe::Saturate>())==std::numeric_limits<int>::max());
+				CHECK(((-e).Get<int,Safe::Saturate>()==std::numeric_limits<int>::min()));
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("An expression which no type is wide enough to evaluate exactly") {
+	
+		auto max=std::numeric_limits<std::uint64_t>::max();
+		
+		THEN("The operations are checked and reported when the result is converted") {
+		
+			REQUIRE_THROWS_AS((Safe::Lazy(max)*max*max-max*max*max).Get<std::uint64_t>(),std::overflow_error);
+			CHECK(noexcept((Safe::Lazy(max)*max*max).Get<std::uint64_t,Safe::Wrap>()));
+		
+		}
+	
+	}
+	
+	GIVEN("Expressions whose operands are of different types") {
+	
+		auto max=std::numeric_limits<int>::max();
+		
+		THEN("They are evaluated correctly") {
+		
+			CHECK((Safe::Lazy(max)*max-Safe::Lazy(max)*max).Get<int>()==0);
+			CHECK((Safe::Lazy(std::uint8_t(200))-Integer<std::uint8_t>(201)).Get<int>()==-1);
+			REQUIRE_THROWS_AS((Safe::Lazy(-1)+Integer<unsigned int>(0)).Get<unsigned int>(),std::overflow_error);
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Safe integers may be created from literals") {
+
+	using namespace Safe::Literals;
+	
+	GIVEN("Literals which are in range") {
+	
+		THEN("They create safe integers of the corresponding type") {
+		
+			CHECK((std::is_same<decltype(255_u8),Integer<std::uint8_t>>::value));
+			CHECK((std::is_same<decltype(1_i16),Integer<std::int16_t>>::value));
+			CHECK((std::is_same<decltype(1_sz),Integer<std::size_t>>::value));
+			CHECK((std::is_same<decltype(1_pd),Integer<std::ptrdiff_t>>::value));
+			CHECK(255_u8==255);
+			CHECK(127_i8==127);
+			CHECK(-127_i8==-127);
+			CHECK(0_u32==0U);
+			CHECK(0x7FFF_i16==32767);
+			CHECK(0xffffffffffffffff_u64==std::numeric_limits<std::uint64_t>::max());
+			CHECK(017_i32==15);
+			CHECK(9223372036854775807_i64==std::numeric_limits<std::int64_t>::max());
+		
+		}
+	
+	}
+	
+	GIVEN("A literal") {
+	
+		auto i=200_u8;
+		
+		THEN("Arithmetic on it is checked") {
+		
+			REQUIRE_THROWS_AS(i+100,std::overflow_error);
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Safe integers may promote the results of arithmetic so they cannot overflow") {
+
+	GIVEN("A promoting safe integer and a safe integer of another type") {
+	
+		Integer<std::int32_t,Safe::Promote<>> a(std::numeric_limits<std::int32_t>::max());
+		Integer<std::uint16_t> b(std::numeric_limits<std::uint16_t>::max());
+		
+		WHEN("They are multiplied") {
+		
+			auto r=a*b;
+			
+			THEN("The result is wide enough to represent the product") {
+			
+				CHECK(sizeof(r.Get())==8);
+				CHECK(r.Signed);
+				CHECK(r.Get()==std::int64_t(std::numeric_limits<std::int32_t>::max())*std::numeric_limits<std::uint16_t>::max());
+				CHECK(noexcept(a*1));
+			
+			}
+			
+			THEN("Narrowing the result is checked") {
+			
+				Integer<std::int64_t> i(r);
+				CHECK(i==r.Get());
+				REQUIRE_THROWS_AS((Integer<std::int32_t,Safe::Promote<>>(r)),std::overflow_error);
+			
+			}
+		
+		}
+		
+		WHEN("They are added and subtracted") {
+		
+			THEN("The results are wide enough") {
+			
+				CHECK((a+b)==std::int64_t(std::numeric_limits<std::int32_t>::max())+std::numeric_limits<std::uint16_t>::max());
+				CHECK((-a-b-b)==-std::int64_t(std::numeric_limits<std::int32_t>::max())-2*std::numeric_limits<std::uint16_t>::max());
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("A promoting safe integer for which there is no wider type") {
+	
+		Integer<std::uint64_t,Safe::Promote<>> a(std::numeric_limits<std::uint64_t>::max());
+		
+		THEN("Arithmetic is checked") {
+		
+			CHECK((std::is_same<decltype(a+1),Integer<std::uint64_t,Safe::Promote<>>>::value));
+			REQUIRE_THROWS_AS(a+1,std::overflow_error);
+			CHECK((Integer<std::uint64_t,Safe::Promote<Safe::Saturate>>(a)+1)==std::numeric_limits<std::uint64_t>::max());
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Ranges of safe integers may be iterated without checking each step") {
+
+	GIVEN("A range") {
+	
+		Safe::Range<int> r(2,11,3);
+		
+		THEN("It yields each value") {
+		
+			std::vector<int> v;
+			for (auto i : r) v.push_back(i);
+			CHECK((v==std::vector<int>{2,5,8}));
+			CHECK(r.size()==3U);
+			CHECK((std::is_same<decltype(*r.begin()),Integer<int>>::value));
+			CHECK(std::accumulate(r.begin(),r.end(),0)==15);
+			CHECK(r.begin()[2]==8);
+			CHECK((r.end()-r.begin())==3);
+			CHECK(*(r.end()-1)==8);
+		
+		}
+	
+	}
+	
+	GIVEN("Ranges which end at the limits of their type") {
+	
+		THEN("Iterating them does not overflow") {
+		
+			Safe::Range<std::int8_t> a(127,-128,-1);
+			CHECK(a.size()==255U);
+			int count=0;
+			for (auto i : a) {
+			
+				++count;
+				CHECK(i==128-count);
+			
+			}
+			CHECK(count==255);
+			Safe::Range<int> b(std::numeric_limits<int>::min(),std::numeric_limits<int>::max(),196611);
+			CHECK(b.size()==21845U);
+			CHECK(*(b.end()-1)==std::numeric_limits<int>::max()-196611);
+			CHECK(Safe::Range<std::uint8_t>(0,255,85).size()==3U);
+		
+		}
+	
+	}
+	
+	GIVEN("Ranges which would step past the limits of their type") {
+	
+		THEN("Creating them throws") {
+		
+			REQUIRE_THROWS_AS(Safe::Range<std::uint8_t>(0,255,128),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Range<int>(0,std::numeric_limits<int>::max(),std::numeric_limits<int>::max()/2),std::overflow_error);
+		
+		}
+		
+		THEN("The exception thrown describes the range") {
+		
+			try {
+			
+				Safe::Range<std::uint8_t>(0,255,128);
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::Range);
+				CHECK(std::string(ex.what())=="Integer value out of range (range of 0, 255, and 128 in 8 bit unsigned)");
+			
+			}
+		
+		}
+		
+		THEN("Creating them with a policy which does not throw invokes the policy and yields an empty range") {
+		
+			overflows=0;
+			CHECK((Safe::Range<std::uint8_t,Safe::Saturate>(0,255,128).empty()));
+			CHECK((Safe::Range<std::uint8_t,Safe::Callback<count_overflow>>(0,255,128).empty()));
+			CHECK(overflows==1);
+		
+		}
+	
+	}
+	
+	GIVEN("Empty ranges") {
+	
+		THEN("They have no values") {
+		
+			CHECK(Safe::Range<int>(0).empty());
+			CHECK(Safe::Range<int>(5,0).empty());
+			CHECK(Safe::Range<int>(0,5,-1).empty());
+			CHECK(Safe::Range<unsigned int>(5).size()==5U);
+		
+		}
+	
+	}
+	
+	GIVEN("A range with a step of zero") {
+	
+		THEN("Creating it throws") {
+		
+			REQUIRE_THROWS_AS(Safe::Range<int>(0,5,0),std::overflow_error);
+		
+		}
+		
+		THEN("Creating it with a policy which does not throw yields an empty range") {
+		
+			CHECK((Safe::Range<int,Safe::Wrap>(0,5,0).empty()));
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Safe integers may be incremented, decremented, and compound assigned with safe integers of the same type") {
+
+	GIVEN("Safe integers at the limits of their type") {
+	
+		Integer<std::int8_t> a(std::numeric_limits<std::int8_t>::max());
+		Integer<std::uint8_t> b(0);
+		
+		THEN("Incrementing and decrementing past the limits throws") {
+		
+			REQUIRE_THROWS_AS(++a,std::overflow_error);
+			REQUIRE_THROWS_AS(a++,std::overflow_error);
+			REQUIRE_THROWS_AS(--b,std::overflow_error);
+			REQUIRE_THROWS_AS(b--,std::overflow_error);
+			CHECK(a==127);
+			CHECK(b==0);
+		
+		}
+		
+		THEN("Incrementing and decrementing within the limits does not throw") {
+		
+			CHECK(--a==126);
+			CHECK(a++==126);
+			CHECK(a==127);
+			CHECK(++b==1);
+			CHECK(b--==1);
+			CHECK(b==0);
+		
+		}
+	
+	}
+	
+	GIVEN("Safe integers with policies other than throwing") {
+	
+		Integer<std::int8_t,Safe::Saturate> a(std::numeric_limits<std::int8_t>::max());
+		Integer<std::uint8_t,Safe::Wrap> b(0);
+		
+		THEN("Incrementing and decrementing past the limits follows the policy") {
+		
+			CHECK(++a==127);
+			CHECK(--b==255);
+			CHECK(++b==0);
+		
+		}
+	
+	}
+	
+	GIVEN("Two safe integers of the same type") {
+	
+		Integer<int> a(std::numeric_limits<int>::max()-1);
+		Integer<int> b(1);
+		
+		THEN("Compound assignment is checked") {
+		
+			CHECK((a+=b)==std::numeric_limits<int>::max());
+			REQUIRE_THROWS_AS(a+=b,std::overflow_error);
+			CHECK((a-=b)==std::numeric_limits<int>::max()-1);
+			CHECK((a*=b)==std::numeric_limits<int>::max()-1);
+			CHECK((a/=b)==std::numeric_limits<int>::max()-1);
+			CHECK((a%=Integer<int>(7))==(std::numeric_limits<int>::max()-1)%7);
+			Integer<int> c(std::numeric_limits<int>::min());
+			REQUIRE_THROWS_AS(c-=b,std::overflow_error);
+			REQUIRE_THROWS_AS(c*=Integer<int>(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(c/=Integer<int>(0),std::overflow_error);
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Signed safe integers may be negated, and their magnitude found as an unsigned integer") {
+
+	GIVEN("The minimum value of a signed type") {
+	
+		Integer<int> a(std::numeric_limits<int>::min());
+		
+		THEN("Negating it throws") {
+		
+			REQUIRE_THROWS_AS(-a,std::overflow_error);
+		
+		}
+		
+		THEN("Negating it with a policy other than throwing follows the policy") {
+		
+			CHECK((-Integer<int,Safe::Saturate>(a.Get())==std::numeric_limits<int>::max()));
+			CHECK((-Integer<int,Safe::Wrap>(a.Get())==std::numeric_limits<int>::min()));
+		
+		}
+		
+		THEN("Its unsigned absolute value is correct") {
+		
+			auto u=a.UnsignedAbs();
+			CHECK((std::is_same<decltype(u),Integer<unsigned int>>::value));
+			CHECK(u==static_cast<unsigned int>(std::numeric_limits<int>::max())+1U);
+		
+		}
+	
+	}
+	
+	GIVEN("Other signed values") {
+	
+		THEN("Negating them does not throw") {
+		
+			CHECK(-Integer<int>(std::numeric_limits<int>::max())==-std::numeric_limits<int>::max());
+			CHECK(-Integer<int>(-5)==5);
+			CHECK(-Integer<int>(0)==0);
+		
+		}
+		
+		THEN("Their unsigned absolute values are correct") {
+		
+			CHECK(Integer<std::int8_t>(-5).UnsignedAbs()==5);
+			CHECK(Integer<std::int8_t>(5).UnsignedAbs()==5);
+			CHECK(Integer<std::int8_t>(-128).UnsignedAbs()==128);
+		
+		}
+	
+	}
+	
+	GIVEN("Unsigned values") {
+	
+		THEN("Their unsigned absolute values are themselves") {
+		
+			CHECK(Integer<unsigned int>(std::numeric_limits<unsigned int>::max()).UnsignedAbs()==std::numeric_limits<unsigned int>::max());
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Integers may be multiplied and added or subtracted, checking only the result") {
+
+	GIVEN("Operands whose product is representable") {
+	
+		THEN("The results are correct") {
+		
+			CHECK(Safe::MulAdd(Integer<int>(100),4,5)==405);
+			CHECK(Safe::MulAdd(100,Integer<int>(4),Integer<short>(5))==405);
+			CHECK(Safe::MulSub(100,4,Integer<int>(5))==395);
+			CHECK(Safe::MulSub(Integer<unsigned int>(3),4U,12U)==0U);
+			CHECK((std::is_same<decltype(Safe::MulAdd(std::int8_t(1),1,1)),Integer<std::int8_t>>::value));
+			CHECK((std::is_same<decltype(Safe::MulAdd(1,Integer<long,Safe::Wrap>(1),Integer<int,Safe::Saturate>(1))),Integer<int,Safe::Wrap>>::value));
+		
+		}
+	
+	}
+	
+	GIVEN("Operands whose product is not representable, but whose result is") {
+	
+		THEN("The results are correct") {
+		
+			CHECK(Safe::MulAdd(std::int8_t(-16),std::int8_t(-8),std::int8_t(-1))==127);
+			CHECK(Safe::MulSub(std::uint8_t(16),std::uint8_t(16),std::uint8_t(1))==255U);
+			CHECK(Safe::MulSub(std::numeric_limits<int>::min(),-1,1)==std::numeric_limits<int>::max());
+		
+		}
+	
+	}
+	
+	GIVEN("Operands which are out of range of the type of the multiplicand") {
+	
+		THEN("The results are computed exactly") {
+		
+			CHECK(Safe::MulAdd(Integer<std::int8_t>(2),100,-300)==-100);
+			CHECK(Safe::MulSub(Integer<std::uint8_t>(3),1000,2900)==100U);
+			CHECK(Safe::MulAdd(std::int8_t(-1),std::numeric_limits<std::uint64_t>::max(),std::numeric_limits<std::uint64_t>::max())==0);
+			CHECK(Safe::MulAdd(std::int64_t(-2),std::uint64_t(1)<<63,std::numeric_limits<std::uint64_t>::max())==-1);
+			REQUIRE_THROWS_AS(Safe::MulAdd(Integer<std::int8_t>(2),100,-10),std::overflow_error);
+		
+		}
+		
+		THEN("The policy is applied to the result") {
+		
+			CHECK(Safe::MulAdd(Integer<std::int8_t,Safe::Saturate>(2),100,-300)==-100);
+			CHECK(Safe::MulAdd(Integer<std::int8_t,Safe::Saturate>(-2),1000,0)==-128);
+			CHECK(Safe::MulSub(Integer<std::uint8_t,Safe::Saturate>(1),1,-1000)==255U);
+			CHECK(Safe::MulAdd(Integer<std::uint8_t,Safe::Wrap>(3),1000,0)==184U);
+			CHECK(Safe::MulSub(Integer<std::int8_t,Safe::Wrap>(1),300,-1000)==static_cast<std::int8_t>(1300%256));
+		
+		}
+	
+	}
+	
+	GIVEN("Operands whose result is not representable") {
+	
+		THEN("Computing the result throws") {
+		
+			REQUIRE_THROWS_AS(Safe::MulAdd(std::int8_t(16),std::int8_t(8),std::int8_t(0)),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::MulAdd(std::numeric_limits<int>::max(),1,1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::MulSub(3U,4U,13U),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::MulSub(std::numeric_limits<int>::min(),1,1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::MulAdd(1,1,std::numeric_limits<long long>::max()),std::overflow_error);
+		
+		}
+		
+		THEN("Computing the result with a policy other than throwing follows the policy") {
+		
+			CHECK(Safe::MulAdd(Integer<std::int8_t,Safe::Saturate>(16),-8,-1)==-128);
+			CHECK(Safe::MulSub(Integer<unsigned int,Safe::Saturate>(3),4U,13U)==0U);
+			CHECK(Safe::MulAdd(Integer<std::uint8_t,Safe::Wrap>(16),16,1)==1U);
+		
+		}
+		
+		THEN("The exception thrown describes the operation") {
+		
+			try {
+			
+				Safe::MulAdd(std::int8_t(16),std::int8_t(8),std::int8_t(1));
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::MultiplyAdd);
+				REQUIRE(ex.OperandCount()==3);
+				CHECK(std::string(ex.what())=="Integer value out of range (multiply-add of 16, 8, and 1 in 8 bit signed)");
+			
+			}
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Any number of integers may be summed or multiplied, checking only the result") {
+
+	GIVEN("Integers whose sum and product are representable") {
+	
+		THEN("The results are correct") {
+		
+			CHECK(Safe::Sum(1)==1);
+			CHECK(Safe::Sum(1,2,3,4,5)==15);
+			CHECK(Safe::Sum(Integer<short>(1),2,Integer<std::int8_t>(3),4L)==10);
+			CHECK(Safe::Product(2)==2);
+			CHECK(Safe::Product(2,Integer<int>(3),4U)==24);
+			CHECK(Safe::Product(std::uint8_t(2),2,2,2,2,2,2)==128U);
+			CHECK((std::is_same<decltype(Safe::Sum(std::int8_t(1),1,1)),Integer<std::int8_t>>::value));
+			CHECK((std::is_same<decltype(Safe::Product(1,Integer<long,Safe::Wrap>(1))),Integer<int,Safe::Wrap>>::value));
+		
+		}
+	
+	}
+	
+	GIVEN("Integers whose partial results are not representable, but whose results are") {
+	
+		THEN("The results are correct") {
+		
+			CHECK(Safe::Sum(std::int8_t(100),std::int8_t(100),std::int8_t(-100))==100);
+			CHECK(Safe::Sum(std::int16_t(30000),std::int16_t(30000),std::int16_t(-30000))==30000);
+			CHECK(Safe::Product(std::int8_t(16),std::int8_t(16),std::int8_t(0))==0);
+			CHECK(Safe::Sum(std::numeric_limits<int>::max(),1,-1)==std::numeric_limits<int>::max());
+		
+		}
+	
+	}
+	
+	GIVEN("Integers which are out of range of the type of the first") {
+	
+		THEN("The results are computed exactly") {
+		
+			CHECK(Safe::Sum(Integer<std::int8_t>(100),1000,-1000)==100);
+			CHECK(Safe::Sum(std::uint8_t(0),-1,1)==0U);
+			CHECK(Safe::Sum(std::int64_t(0),std::numeric_limits<std::uint64_t>::max(),std::numeric_limits<std::uint64_t>::max(),std::numeric_limits<std::int64_t>::min(),std::numeric_limits<std::int64_t>::min(),std::numeric_limits<std::int64_t>::min(),std::numeric_limits<std::int64_t>::min())==-2);
+			CHECK(Safe::Product(Integer<std::uint8_t>(1),-1,-1)==1U);
+			CHECK(Safe::Product(Integer<std::int8_t>(1),std::numeric_limits<std::uint64_t>::max(),std::numeric_limits<std::uint64_t>::max(),0)==0);
+			REQUIRE_THROWS_AS(Safe::Sum(Integer<std::int8_t>(100),1000,-900),std::overflow_error);
+		
+		}
+		
+		THEN("The policy is applied to the result") {
+		
+			CHECK(Safe::Sum(Integer<std::int8_t,Safe::Saturate>(100),1000,-1000)==100);
+			CHECK(Safe::Product(Integer<std::uint8_t,Safe::Saturate>(2),-1,-100)==200U);
+			CHECK(Safe::Product(Integer<std::int8_t,Safe::Saturate>(1),1000,-1)==-128);
+			CHECK(Safe::Sum(Integer<std::uint8_t,Safe::Wrap>(1),1000)==233U);
+			CHECK(Safe::Product(Integer<std::int8_t,Safe::Wrap>(1),std::numeric_limits<std::uint64_t>::max(),std::numeric_limits<std::uint64_t>::max())==1);
+		
+		}
+	
+	}
+	
+	GIVEN("Integers whose sum or product is not representable") {
+	
+		THEN("Computing the result throws") {
+		
+			REQUIRE_THROWS_AS(Safe::Sum(std::int8_t(100),std::int8_t(27),std::int8_t(1)),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Sum(0U,1U,std::numeric_limits<unsigned int>::max()),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Product(std::uint8_t(2),2,2,2,2,2,2,2,2),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Product(std::numeric_limits<int>::min(),-1,1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Sum(1,std::numeric_limits<long long>::max()),std::overflow_error);
+		
+		}
+		
+		THEN("Computing the result with a policy other than throwing follows the policy") {
+		
+			CHECK(Safe::Sum(Integer<std::int8_t,Safe::Saturate>(-100),-100,50)==-128);
+			CHECK(Safe::Product(Integer<std::int8_t,Safe::Saturate>(-100),-100,50)==127);
+			CHECK(Safe::Sum(Integer<std::uint8_t,Safe::Wrap>(200),200)==144U);
+		
+		}
+		
+		THEN("The exception thrown describes the operation") {
+		
+			try {
+			
+				Safe::Product(std::int8_t(16),std::int8_t(8),std::int8_t(1));
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::Product);
+				CHECK(std::string(ex.what())=="Integer value out of range (product of -128 in 8 bit signed)");
+			
+			}
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Integers may be multiplied and divided, checking only the result") {
+
+	GIVEN("Operands whose product is not representable, but whose result is") {
+	
+		THEN("The results are correct") {
+		
+			CHECK(Safe::MulDiv(std::numeric_limits<int>::max(),1000,2000)==std::numeric_limits<int>::max()/2);
+			CHECK(Safe::MulDiv(Integer<std::uint8_t>(200),200,250)==160U);
+			CHECK(Safe::MulDiv(std::numeric_limits<int>::min(),-1,-1)==std::numeric_limits<int>::min());
+			CHECK((std::is_same<decltype(Safe::MulDiv(std::int8_t(1),1,1)),Integer<std::int8_t>>::value));
+		
+		}
+	
+	}
+	
+	GIVEN("Operands whose quotient has a remainder") {
+	
+		THEN("The result is rounded as requested") {
+		
+			CHECK(Safe::MulDiv(7,1,2)==3);
+			CHECK(Safe::MulDiv(-7,1,2)==-3);
+			CHECK(Safe::MulDiv<Safe::Rounding::Truncate>(-7,1,2)==-3);
+			CHECK(Safe::MulDiv<Safe::Rounding::Floor>(7,1,2)==3);
+			CHECK(Safe::MulDiv<Safe::Rounding::Floor>(-7,1,2)==-4);
+			CHECK(Safe::MulDiv<Safe::Rounding::Floor>(7,1,-2)==-4);
+			CHECK(Safe::MulDiv<Safe::Rounding::Ceiling>(7,1,2)==4);
+			CHECK(Safe::MulDiv<Safe::Rounding::Ceiling>(-7,1,2)==-3);
+			CHECK(Safe::MulDiv<Safe::Rounding::Ceiling>(7U,1U,2U)==4U);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(7,1,2)==4);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(-7,1,2)==-4);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(5,1,3)==2);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(4,1,3)==1);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(-4,1,-3)==1);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(7U,1U,2U)==4U);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(std::numeric_limits<unsigned int>::max(),1U,std::numeric_limits<unsigned int>::max()-1U)==1U);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(std::numeric_limits<int>::max(),1,std::numeric_limits<int>::min())==-1);
+		
+		}
+	
+	}
+	
+	GIVEN("Operands which are out of range of the type of the multiplicand") {
+	
+		THEN("The results are computed exactly") {
+		
+			CHECK(Safe::MulDiv(Integer<std::int8_t>(100),1000,1000)==100);
+			CHECK(Safe::MulDiv(Integer<std::int8_t>(-3),100000,-1000000)==0);
+			CHECK(Safe::MulDiv<Safe::Rounding::Ceiling>(Integer<std::int8_t>(-3),100000,-1000000)==1);
+			CHECK(Safe::MulDiv<Safe::Rounding::Floor>(Integer<std::int8_t>(3),100000,-1000000)==-1);
+			CHECK(Safe::MulDiv<Safe::Rounding::Nearest>(Integer<std::int8_t>(-5),100000,-1000000)==1);
+			CHECK(Safe::MulDiv(std::int64_t(3),std::numeric_limits<std::uint64_t>::max(),std::numeric_limits<std::uint64_t>::max())==3);
+			CHECK(Safe::MulDiv(std::int64_t(-2),std::uint64_t(1)<<63,std::numeric_limits<std::uint64_t>::max())==-1);
+			CHECK(Safe::MulDiv<Safe::Rounding::Floor>(std::int64_t(-2),std::uint64_t(1)<<63,std::numeric_limits<std::uint64_t>::max())==-2);
+			REQUIRE_THROWS_AS(Safe::MulDiv(Integer<std::int8_t>(1),1000,1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::MulDiv(Integer<std::int8_t>(1),1000,0),std::overflow_error);
+		
+		}
+		
+		THEN("The policy is applied to the result") {
+		
+			CHECK(Safe::MulDiv(Integer<std::int8_t,Safe::Saturate>(100),3,-300)==-1);
+			CHECK(Safe::MulDiv(Integer<std::uint8_t,Safe::Saturate>(10),-1,1)==0U);
+			CHECK(Safe::MulDiv(Integer<std::int8_t,Safe::Saturate>(-1),1000,0)==-128);
+			CHECK(Safe::MulDiv(Integer<std::int8_t,Safe::Wrap>(100),1,257)==0);
+			CHECK(Safe::MulDiv(Integer<std::uint8_t,Safe::Wrap>(100),1000,3)==53U);
+		
+		}
+	
+	}
+	
+	GIVEN("Operands whose result is not representable") {
+	
+		THEN("Computing the result throws") {
+		
+			REQUIRE_THROWS_AS(Safe::MulDiv(std::numeric_limits<int>::max(),2,1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::MulDiv(std::numeric_limits<int>::min(),1,-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::MulDiv<Safe::Rounding::Ceiling>(std::uint8_t(255),std::uint8_t(255),std::uint8_t(254)),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::MulDiv(1,1,0),std::overflow_error);
+		
+		}
+		
+		THEN("Computing the result with a policy other than throwing follows the policy") {
+		
+			CHECK(Safe::MulDiv(Integer<std::int8_t,Safe::Saturate>(100),100,-50)==-128);
+			CHECK(Safe::MulDiv(Integer<std::int8_t,Safe::Saturate>(1),1,0)==127);
+			CHECK(Safe::MulDiv(Integer<std::int8_t,Safe::Saturate>(-5),1,0)==-128);
+			CHECK(Safe::MulDiv(Integer<std::int64_t,Safe::Saturate>(5),-1,0)==std::numeric_limits<std::int64_t>::min());
+			CHECK(Safe::MulDiv(Integer<std::int8_t,Safe::Saturate>(0),1,0)==0);
+		
+		}
+	
+	}
+
+}
+
+
+template <typename T>
+static std::size_t divisor_mismatches (T d, const std::vector<T> & dividends) {
+
+	Safe::Divisor<T> divisor(d);
+	std::size_t retr=0;
+	for (auto a : dividends) if ((divisor.Divide(a)!=static_cast<T>(a/d)) || (divisor.Modulus(a)!=static_cast<T>(a%d))) ++retr;
+	
+	return retr;
+
+}
+
+
+template <typename T>
+static std::size_t divisor_mismatches (T d) {
+
+	Safe::Divisor<T> divisor(d);
+	std::size_t retr=0;
+	for (auto i : Safe::Range<T>(std::numeric_limits<T>::min(),std::numeric_limits<T>::max())) {
+	
+		T a=i;
+		if ((divisor.Divide(a)!=static_cast<T>(a/d)) || (divisor.Modulus(a)!=static_cast<T>(a%d))) ++retr;
+	
+	}
+	
+	return retr+divisor_mismatches(d,std::vector<T>{std::numeric_limits<T>::max()});
+
+}
+
+
+template <typename T>
+static std::vector<T> divisor_edge_cases () {
+
+	typedef std::numeric_limits<T> limits;
+	std::vector<T> retr{0,1,2,3,7,10,100,1000,limits::max(),static_cast<T>(limits::max()-1),static_cast<T>(limits::max()/2),static_cast<T>(limits::max()/3),limits::min(),static_cast<T>(limits::min()+1)};
+	if (std::is_signed<T>::value) for (auto i : std::vector<T>(retr)) if (i>1) retr.push_back(static_cast<T>(-i));
+	
+	return retr;
+
+}
+
+
+SCENARIO("Safe integers may be divided by an invariant divisor") {
+
+	GIVEN("Every divisor of an 8 bit type") {
+	
+		THEN("Dividing every value by it gives the same result as built in division") {
+		
+			std::size_t mismatches=0;
+			for (int d=-128;d<128;++d) if ((d!=0) && (d!=-1)) mismatches+=divisor_mismatches(static_cast<std::int8_t>(d));
+			for (int d=1;d<256;++d) mismatches+=divisor_mismatches(static_cast<std::uint8_t>(d));
+			CHECK(mismatches==0);
+		
+		}
+	
+	}
+	
+	GIVEN("Divisors of wider types") {
+	
+		THEN("Dividing by them gives the same result as built in division") {
+		
+			std::size_t mismatches=0;
+			for (auto d : divisor_edge_cases<std::int16_t>()) if ((d!=0) && (d!=-1)) mismatches+=divisor_mismatches(d);
+			for (auto d : divisor_edge_cases<int>()) if ((d!=0) && (d!=-1)) mismatches+=divisor_mismatches(d,divisor_edge_cases<int>());
+			for (auto d : divisor_edge_cases<unsigned int>()) if (d!=0) mismatches+=divisor_mismatches(d,divisor_edge_cases<unsigned int>());
+			for (auto d : divisor_edge_cases<long long>()) if ((d!=0) && (d!=-1)) mismatches+=divisor_mismatches(d,divisor_edge_cases<long long>());
+			for (auto d : divisor_edge_cases<unsigned long long>()) if (d!=0) mismatches+=divisor_mismatches(d,divisor_edge_cases<unsigned long long>());
+			CHECK(mismatches==0);
+		
+		}
+	
+	}
+	
+	GIVEN("A safe integer and a divisor") {
+	
+		Integer<int> a(-100);
+		Safe::Divisor<int> d(7);
+		
+		THEN("Dividing and finding the remainder works") {
+		
+			CHECK((a/d)==-14);
+			CHECK((a%d)==-2);
+			CHECK((std::is_same<decltype(a/d),Integer<int>>::value));
+			a/=d;
+			CHECK(a==-14);
+			a%=d;
+			CHECK(a==0);
+			CHECK(d.Get()==7);
+		
+		}
+	
+	}
+	
+	GIVEN("A divisor of zero or negative one") {
+	
+		THEN("Creating it throws") {
+		
+			REQUIRE_THROWS_AS(Safe::Divisor<int>(0),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Divisor<unsigned int>(0),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Divisor<int>(-1),std::overflow_error);
+			CHECK(Safe::Divisor<unsigned int>(std::numeric_limits<unsigned int>::max()).Divide(std::numeric_limits<unsigned int>::max())==1U);
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Safe integers may be combined with compile time constants") {
+
+	typedef std::numeric_limits<std::int8_t> limits;
+	
+	GIVEN("Safe integers and constants whose results are representable") {
+	
+		THEN("The results are correct") {
+		
+			CHECK((Integer<int>(5)+Safe::Constant<3>())==8);
+			CHECK((Integer<int>(5)-Safe::Constant<-3>())==8);
+			CHECK((Integer<int>(5)*Safe::Constant<8>())==40);
+			CHECK((Integer<int>(-41)/Safe::Constant<8>())==-5);
+			CHECK((Integer<int>(-41)%Safe::Constant<8>())==-1);
+			CHECK((Integer<int>(41)/Safe::Constant<-1>())==-41);
+			CHECK((Integer<int>(std::numeric_limits<int>::min())%Safe::Constant<-1>())==0);
+			CHECK((Safe::Constant<3>()+Integer<unsigned int>(5))==8U);
+			CHECK((std::integral_constant<unsigned int,3>()*Integer<std::uint8_t>(5))==15U);
+			CHECK((std::is_same<decltype(Integer<std::int8_t>(1)*Safe::Constant<2>()),Integer<std::int8_t>>::value));
+		
+		}
+	
+	}
+	
+	GIVEN("Safe integers at the bounds of the results") {
+	
+		THEN("Only those out of range throw") {
+		
+			CHECK((Integer<std::int8_t>(124)+Safe::Constant<3>())==127);
+			REQUIRE_THROWS_AS(Integer<std::int8_t>(125)+Safe::Constant<3>(),std::overflow_error);
+			CHECK((Integer<std::int8_t>(-125)+Safe::Constant<-3>())==-128);
+			REQUIRE_THROWS_AS(Integer<std::int8_t>(-126)+Safe::Constant<-3>(),std::overflow_error);
+			CHECK((Integer<std::int8_t>(-125)-Safe::Constant<3>())==-128);
+			REQUIRE_THROWS_AS(Integer<std::int8_t>(-126)-Safe::Constant<3>(),std::overflow_error);
+			CHECK((Integer<std::int8_t>(124)-Safe::Constant<-3>())==127);
+			REQUIRE_THROWS_AS(Integer<std::int8_t>(125)-Safe::Constant<-3>(),std::overflow_error);
+			CHECK((Integer<std::uint8_t>(3)-Safe::Constant<3>())==0U);
+			REQUIRE_THROWS_AS(Integer<std::uint8_t>(2)-Safe::Constant<3>(),std::overflow_error);
+			CHECK((Integer<std::int8_t>(0)+Safe::Constant<limits::max()>())==127);
+			CHECK((Integer<std::int8_t>(0)+Safe::Constant<limits::min()>())==-128);
+			REQUIRE_THROWS_AS(Integer<std::int8_t>(-1)+Safe::Constant<limits::min()>(),std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<std::int8_t>(0)-Safe::Constant<limits::min()>(),std::overflow_error);
+		
+		}
+		
+		THEN("Only those products out of range throw") {
+		
+			std::size_t mismatches=0;
+			for (int a=-128;a<128;++a) {
+			
+				Integer<std::int8_t,Safe::Saturate> i(a);
+				auto expected=[] (int r) {	return static_cast<std::int8_t>((r>127) ? 127 : ((r<-128) ? -128 : r));	};
+				if ((i*Safe::Constant<0>())!=expected(a*0)) ++mismatches;
+				if ((i*Safe::Constant<1>())!=expected(a)) ++mismatches;
+				if ((i*Safe::Constant<-1>())!=expected(-a)) ++mismatches;
+				if ((i*Safe::Constant<3>())!=expected(a*3)) ++mismatches;
+				if ((i*Safe::Constant<-3>())!=expected(a*-3)) ++mismatches;
+				if ((i*Safe::Constant<8>())!=expected(a*8)) ++mismatches;
+				if ((i*Safe::Constant<-128>())!=expected(a*-128)) ++mismatches;
+				if ((i*Safe::Constant<127>())!=expected(a*127)) ++mismatches;
+				if ((i/Safe::Constant<-1>())!=expected(-a)) ++mismatches;
+				if ((i+Safe::Constant<100>())!=expected(a+100)) ++mismatches;
+				if ((i-Safe::Constant<-100>())!=expected(a+100)) ++mismatches;
+			
+			}
+			CHECK(mismatches==0);
+			REQUIRE_THROWS_AS(Integer<std::uint8_t>(64)*Safe::Constant<4>(),std::overflow_error);
+			CHECK((Integer<std::uint8_t>(63)*Safe::Constant<4>())==252U);
+			REQUIRE_THROWS_AS(Integer<int>(std::numeric_limits<int>::min())/Safe::Constant<-1>(),std::overflow_error);
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Integers may be raised to a power") {
+
+	GIVEN("Bases and exponents whose powers are representable") {
+	
+		THEN("The results are correct") {
+		
+			CHECK(Safe::Pow(10,9)==1000000000);
+			CHECK(Safe::Pow(Integer<long long>(10),18)==1000000000000000000LL);
+			CHECK(Safe::Pow(Integer<std::uint64_t>(2),63)==(std::uint64_t(1)<<63));
+			CHECK(Safe::Pow(3U,0)==1U);
+			CHECK(Safe::Pow(0,0)==1);
+			CHECK(Safe::Pow(0,100)==0);
+			CHECK(Safe::Pow(1,1000)==1);
+			CHECK(Safe::Pow(-1,1001)==-1);
+			CHECK(Safe::Pow(-1,1000)==1);
+			CHECK(Safe::Pow(std::int8_t(-2),7)==-128);
+			CHECK(Safe::Pow(std::int8_t(-3),4)==81);
+			CHECK((std::is_same<decltype(Safe::Pow(Integer<short,Safe::Wrap>(2),2)),Integer<short,Safe::Wrap>>::value));
+		
+		}
+		
+		THEN("The results agree with repeated multiplication") {
+		
+			std::size_t mismatches=0;
+			for (int b=-128;b<128;++b) for (unsigned int e=0;e<20;++e) {
+			
+				bool expected_overflow=false;
+				Integer<std::int8_t,Safe::Wrap> expected(1);
+				for (unsigned int i=0;i<e;++i) {
+				
+					int r=expected.Get()*b;
+					if ((r>127) || (r<-128)) expected_overflow=true;
+					expected=static_cast<std::int8_t>(r);
+				
+				}
+				bool overflowed=false;
+				std::int8_t actual=0;
+				try {
+				
+					actual=Safe::Pow(std::int8_t(b),e);
+				
+				} catch (const std::overflow_error &) {
+				
+					overflowed=true;
+				
+				}
+				if ((overflowed!=expected_overflow) || (!overflowed && (actual!=expected.Get())) || (Safe::Pow(Integer<std::int8_t,Safe::Wrap>(b),e)!=expected)) ++mismatches;
+			
+			}
+			CHECK(mismatches==0);
+		
+		}
+	
+	}
+	
+	GIVEN("Bases and exponents whose powers are not representable") {
+	
+		THEN("Computing the result throws") {
+		
+			REQUIRE_THROWS_AS(Safe::Pow(10,10),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Pow(std::int8_t(2),7),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Pow(std::int8_t(-2),9),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Pow(Integer<std::uint64_t>(2),64),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Pow(2,1000),std::overflow_error);
+		
+		}
+		
+		THEN("Computing the result with a policy other than throwing follows the policy") {
+		
+			CHECK(Safe::Pow(Integer<int,Safe::Saturate>(10),10)==std::numeric_limits<int>::max());
+			CHECK(Safe::Pow(Integer<int,Safe::Saturate>(-10),11)==std::numeric_limits<int>::min());
+			CHECK(Safe::Pow(Integer<std::uint8_t,Safe::Wrap>(2),9)==0U);
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("The square roots, logarithms, and bit counts of integers may be found") {
+
+	GIVEN("Non-negative integers") {
+	
+		THEN("Their square roots are correct") {
+		
+			CHECK(Safe::ISqrt(0)==0);
+			CHECK(Safe::ISqrt(1)==1);
+			CHECK(Safe::ISqrt(15)==3);
+			CHECK(Safe::ISqrt(16)==4);
+			CHECK(Safe::ISqrt(std::numeric_limits<int>::max())==46340);
+			CHECK(Safe::ISqrt(std::numeric_limits<std::uint64_t>::max())==0xFFFFFFFFU);
+			CHECK(Safe::ISqrt(std::uint64_t(0xFFFFFFFFU)*0xFFFFFFFFU)==0xFFFFFFFFU);
+			CHECK(Safe::ISqrt(std::uint64_t(0xFFFFFFFFU)*0xFFFFFFFFU-1)==0xFFFFFFFEU);
+			CHECK((std::is_same<decltype(Safe::ISqrt(Safe::size_t(4))),Safe::size_t>::value));
+			std::size_t mismatches=0;
+			for (unsigned int i=0;i<65536;++i) {
+			
+				unsigned int r=Safe::ISqrt(i);
+				if ((r*r>i) || ((r+1)*(r+1)<=i)) ++mismatches;
+			
+			}
+			CHECK(mismatches==0);
+		
+		}
+		
+		THEN("Their logarithms are correct") {
+		
+			CHECK(Safe::ILog2(1)==0);
+			CHECK(Safe::ILog2(2)==1);
+			CHECK(Safe::ILog2(std::uint8_t(255))==7);
+			CHECK(Safe::ILog2(std::numeric_limits<std::uint64_t>::max())==63U);
+			CHECK(Safe::ILog10(1)==0);
+			CHECK(Safe::ILog10(9)==0);
+			CHECK(Safe::ILog10(10)==1);
+			CHECK(Safe::ILog10(std::int8_t(127))==2);
+			CHECK(Safe::ILog10(std::numeric_limits<std::uint64_t>::max())==19U);
+			CHECK(Safe::ILog10(std::uint64_t(10000000000000000000ULL))==19U);
+			CHECK(Safe::ILog10(std::uint64_t(9999999999999999999ULL))==18U);
+			std::size_t mismatches=0;
+			std::uint64_t power=1;
+			for (unsigned int i=0;i<19;++i,power*=10) {
+			
+				if ((Safe::ILog10(power)!=i) || (Safe::ILog10(power*10-1)!=i)) ++mismatches;
+			
+			}
+			CHECK(mismatches==0);
+		
+		}
+		
+		THEN("Their bits are counted correctly") {
+		
+			CHECK(Safe::BitWidth(0)==0);
+			CHECK(Safe::BitWidth(1)==1);
+			CHECK(Safe::BitWidth(std::uint8_t(255))==8U);
+			CHECK(Safe::BitWidth(std::numeric_limits<int>::max())==31);
+			CHECK(Safe::PopCount(0)==0);
+			CHECK(Safe::PopCount(0xF0F0U)==8U);
+			CHECK(Safe::PopCount(std::numeric_limits<std::uint64_t>::max())==64U);
+		
+		}
+	
+	}
+	
+	//	128 bit integers are only integral types in the GNU
+	//	dialects of C++
+	#if defined(SAFE_INT128) && !defined(__STRICT_ANSI__)
+	GIVEN("128 bit integers") {
+	
+		THEN("Their square roots, logarithms, and bit counts are correct") {
+		
+			Safe::UInt128 x=Safe::UInt128(1)<<100;
+			CHECK(Safe::BitWidth(Integer<Safe::UInt128>(x))==101);
+			CHECK(Safe::BitWidth(Integer<Safe::UInt128>(1))==1);
+			CHECK(Safe::PopCount(Integer<Safe::UInt128>(x|1))==2);
+			CHECK(Safe::PopCount(Integer<Safe::UInt128>(~Safe::UInt128(0)))==128);
+			CHECK(Safe::ILog2(Integer<Safe::UInt128>(x))==100);
+			CHECK(Safe::ISqrt(Integer<Safe::UInt128>(x))==(Safe::UInt128(1)<<50));
+			CHECK(Safe::ILog10(Integer<Safe::Int128>(x))==30);
+			CHECK(Safe::ILog10(Integer<Safe::UInt128>(~Safe::UInt128(0)))==38);
+			CHECK(Safe::DivFloor(Integer<Safe::UInt128>(x),Safe::UInt128(1)<<90)==1024);
+			std::size_t mismatches=0;
+			Safe::UInt128 power=1;
+			for (unsigned int i=0;i<38;++i,power*=10) {
+			
+				if ((Safe::ILog10(Integer<Safe::UInt128>(power))!=i) || (Safe::ILog10(Integer<Safe::UInt128>(power*10-1))!=i)) ++mismatches;
+			
+			}
+			CHECK(mismatches==0);
+		
+		}
+	
+	}
+	#endif
+	
+	GIVEN("Arguments for which the results are undefined") {
+	
+		THEN("Computing the result throws") {
+		
+			REQUIRE_THROWS_AS(Safe::ISqrt(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::ILog2(0),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::ILog2(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::ILog10(0U),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::BitWidth(-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::PopCount(Integer<std::int8_t>(-1)),std::overflow_error);
+		
+		}
+		
+		THEN("Computing the result with a policy other than throwing yields zero") {
+		
+			CHECK(Safe::ISqrt(Integer<int,Safe::Saturate>(-4))==0);
+			CHECK(Safe::ILog2(Integer<int,Safe::Wrap>(0))==0);
+		
+		}
+		
+		THEN("The exception thrown describes the operation") {
+		
+			try {
+			
+				Safe::ISqrt(-4);
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::SquareRoot);
+				CHECK(std::string(ex.what())=="Integer value out of range (square root of -4 in 32 bit signed)");
+			
+			}
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Safe integers may be shifted and combined bitwise") {
+
+	GIVEN("Shifts which lose no bits") {
+	
+		THEN("Their results are correct") {
+		
+			CHECK((Integer<std::uint8_t>(1) << 7)==128);
+			CHECK((Integer<std::int8_t>(1) << 6)==64);
+			CHECK((Integer<int>(3) << Integer<std::uint8_t>(4))==48);
+			CHECK((Integer<std::uint32_t>(0x80000000U) >> 31)==1);
+			CHECK((1 << Integer<int>(10))==1024);
+			CHECK((Integer<std::uint16_t>(0x0F00) << Safe::Constant<4>())==0xF000);
+			CHECK((Integer<std::int16_t>(0x7F00) >> Safe::Constant<8>())==0x7F);
+			Integer<std::uint64_t> i(1);
+			i<<=63;
+			CHECK(i==0x8000000000000000ULL);
+			i>>=Integer<int>(60);
+			CHECK(i==8);
+		
+		}
+	
+	}
+	
+	GIVEN("Shifts which are out of range") {
+	
+		THEN("Performing them throws") {
+		
+			REQUIRE_THROWS_AS(Integer<std::uint8_t>(2) << 7,std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<std::int8_t>(1) << 7,std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<int>(-1) << 0,std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<int>(-8) >> 1,std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<std::uint32_t>(0) << 32,std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<std::uint32_t>(1) >> 32,std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<std::uint64_t>(1) << -1,std::overflow_error);
+			REQUIRE_THROWS_AS(Integer<std::uint16_t>(0x8000) << Safe::Constant<1>(),std::overflow_error);
+		
+		}
+		
+		THEN("Performing them with a policy other than throwing behaves according to that policy") {
+		
+			CHECK((Integer<std::uint8_t,Safe::Wrap>(0x81) << 1)==2);
+			CHECK((Integer<std::uint8_t,Safe::Saturate>(0x81) << 1)==255);
+			CHECK((Integer<std::uint8_t,Safe::Saturate>(1) << 8)==0);
+			CHECK((Integer<std::int8_t,Safe::Saturate>(-1) << 1)==0);
+			CHECK((Integer<std::int8_t,Safe::Wrap>(-1) << 1)==0);
+		
+		}
+		
+		THEN("The exception thrown describes the operation") {
+		
+			try {
+			
+				Integer<std::int32_t>(1) << 40;
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::ShiftLeft);
+				CHECK(std::string(ex.what())=="Integer value out of range (shift left of 1 and 40 in 32 bit signed)");
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("Bitwise operations") {
+	
+		THEN("They yield safe integers of the same type as the left hand side") {
+		
+			Integer<std::uint8_t> a(0xF0);
+			auto b=a & 0x3C;
+			static_assert(std::is_same<decltype(b),Integer<std::uint8_t>>::value,"Wrong type");
+			CHECK(b==0x30);
+			CHECK((a | Integer<std::uint8_t>(0x0F))==0xFF);
+			CHECK((a ^ 0xFF)==0x0F);
+			static_assert(std::is_same<decltype(~a),Integer<std::uint8_t>>::value,"Wrong type");
+			CHECK(~a==0x0F);
+			CHECK((0x0FU & Integer<std::uint8_t>(0xFF))==0x0F);
+			a&=0x30;
+			a|=Integer<int>(1);
+			a^=0x11;
+			CHECK(a==0x20);
+		
+		}
+		
+		THEN("Operands which are wider than the left hand side's type are masks of its low bits") {
+		
+			CHECK((Integer<std::int8_t>(-2) & 0xFF)==-2);
+			CHECK((Integer<std::uint32_t>(0x12345678U) & 0xFFFFFFFFULL)==0x12345678U);
+			CHECK((Integer<std::uint8_t>(0xFF) & 0x100)==0);
+			CHECK((Integer<std::uint8_t>(0xF0) | 0x10F)==0xFF);
+			CHECK((Integer<unsigned>(1) | -1)==std::numeric_limits<unsigned>::max());
+			CHECK((Integer<std::int16_t>(0x00FF) ^ Integer<std::uint32_t>(0xFFFF00FFU))==0);
+			CHECK((std::uint8_t(0x0F) & Integer<int>(0x1FF))==0x0F);
+			CHECK((Integer<std::uint8_t,Safe::Saturate>(0xFF) & 0x10F)==0x0F);
+			Integer<std::int8_t> i(0x7F);
+			i^=0xFFFFFFFFU;
+			CHECK(i==-128);
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Midpoints and differences may be found without overflow") {
+
+	GIVEN("Integers of the same type") {
+	
+		THEN("Their midpoint is rounded toward the first and never overflows") {
+		
+			CHECK(Safe::Midpoint(std::numeric_limits<int>::max(),std::numeric_limits<int>::max()-1)==std::numeric_limits<int>::max());
+			CHECK(Safe::Midpoint(std::numeric_limits<int>::max()-1,std::numeric_limits<int>::max())==std::numeric_limits<int>::max()-1);
+			CHECK(Safe::Midpoint(std::numeric_limits<int>::min(),std::numeric_limits<int>::max())==-1);
+			CHECK(Safe::Midpoint(std::numeric_limits<int>::max(),std::numeric_limits<int>::min())==0);
+			CHECK(Safe::Midpoint(Safe::size_t(std::numeric_limits<std::size_t>::max()),std::numeric_limits<std::size_t>::max()-2)==(std::numeric_limits<std::size_t>::max()-1));
+		
+		}
+		
+		THEN("The magnitude of their difference never overflows") {
+		
+			auto d=Safe::AbsDiff(std::numeric_limits<std::int32_t>::min(),std::numeric_limits<std::int32_t>::max());
+			static_assert(std::is_same<decltype(d),Integer<std::uint32_t>>::value,"Wrong type");
+			CHECK(d==std::numeric_limits<std::uint32_t>::max());
+			CHECK(Safe::AbsDiff(3U,10U)==7);
+			CHECK(Safe::AbsDiff(Integer<std::uint8_t>(10),std::uint8_t(3))==7);
+		
+		}
+		
+		THEN("The distance between sizes is a pointer difference") {
+		
+			auto d=Safe::Distance(Safe::size_t(10),Safe::size_t(3));
+			static_assert(std::is_same<decltype(d),Safe::ptrdiff_t>::value,"Wrong type");
+			CHECK(d==-7);
+			CHECK(Safe::Distance(Safe::size_t(0),Safe::size_t(std::numeric_limits<std::ptrdiff_t>::max()))==std::numeric_limits<std::ptrdiff_t>::max());
+			CHECK(Safe::Distance(std::size_t(std::numeric_limits<std::ptrdiff_t>::max())+1,std::size_t(0))==std::numeric_limits<std::ptrdiff_t>::min());
+		
+		}
+		
+		THEN("A distance which cannot be represented throws") {
+		
+			REQUIRE_THROWS_AS(Safe::Distance(Safe::size_t(0),std::size_t(std::numeric_limits<std::ptrdiff_t>::max())+1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Distance(std::size_t(std::numeric_limits<std::ptrdiff_t>::max())+2,std::size_t(0)),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Distance(std::numeric_limits<int>::min(),1),std::overflow_error);
+		
+		}
+	
+	}
+	
+	GIVEN("Integers of different signedness") {
+	
+		THEN("Their midpoint and differences are exact") {
+		
+			CHECK(Safe::Midpoint(-5,10U)==2);
+			CHECK(Safe::Midpoint(10U,-5)==3);
+			CHECK(Safe::Midpoint(std::numeric_limits<std::uint32_t>::max(),std::int8_t(-128))==2147483584U);
+			CHECK(Safe::AbsDiff(-5,10U)==15);
+			CHECK(Safe::AbsDiff(std::int64_t(-1),std::numeric_limits<std::uint32_t>::max())==std::uint64_t(std::numeric_limits<std::uint32_t>::max())+1);
+			CHECK(Safe::Distance(10U,-5)==-15);
+		
+		}
+		
+		THEN("Results which cannot be represented throw") {
+		
+			REQUIRE_THROWS_AS(Safe::Midpoint(std::int8_t(-1),std::uint16_t(65535)),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Midpoint(0U,-2),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::AbsDiff(-1,std::numeric_limits<unsigned>::max()),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::Distance(-1,std::numeric_limits<unsigned>::max()),std::overflow_error);
+		
+		}
+		
+		THEN("The exception thrown describes the operation") {
+		
+			try {
+			
+				Safe::AbsDiff(std::int8_t(-1),std::uint8_t(255));
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::Difference);
+				CHECK(std::string(ex.what())=="Integer value out of range (difference of -1 and 255 in 8 bit unsigned)");
+			
+			}
+			
+			try {
+			
+				Safe::Distance(std::int8_t(-1),std::uint8_t(255));
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::Difference);
+				CHECK(std::string(ex.what())=="Integer value out of range (difference of -1 and 255 in 8 bit signed)");
+			
+			}
+		
+		}
+	
+	}
+
+}
+
+
+SCENARIO("Sizes may be aligned and rounded without overflow") {
+
+	GIVEN("A power of two alignment") {
+	
+		THEN("Integers are rounded up and down to multiples of it") {
+		
+			CHECK(Safe::AlignUp(Safe::size_t(13),8)==16);
+			CHECK(Safe::AlignUp(Safe::size_t(16),8)==16);
+			CHECK(Safe::AlignUp(Safe::size_t(0),8)==0);
+			CHECK(Safe::AlignDown(Safe::size_t(13),8)==8);
+			CHECK(Safe::AlignUp(-13,8)==-8);
+			CHECK(Safe::AlignDown(-13,8)==-16);
+			CHECK(Safe::AlignUp(std::numeric_limits<std::size_t>::max()-7,8)==(std::numeric_limits<std::size_t>::max()-7));
+		
+		}
+		
+		THEN("Rounding up past the largest multiple throws") {
+		
+			REQUIRE_THROWS_AS(Safe::AlignUp(std::numeric_limits<std::size_t>::max()-6,8),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::AlignUp(std::numeric_limits<int>::max(),2),std::overflow_error);
+		
+		}
+	
+	}
+	
+	GIVEN("An alignment which isn't a power of two") {
+	
+		THEN("Aligning throws") {
+		
+			REQUIRE_THROWS_AS(Safe::AlignUp(Safe::size_t(13),12),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::AlignDown(Safe::size_t(13),0),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::AlignDown(13,-8),std::overflow_error);
+		
+		}
+		
+		THEN("Aligning with a policy other than throwing follows the policy") {
+		
+			CHECK(Safe::AlignUp(Integer<std::uint8_t,Safe::Wrap>(1),258)==0U);
+			CHECK(Safe::AlignDown(Integer<std::uint8_t,Safe::Saturate>(200),256)==0U);
+			CHECK(Safe::RoundUpToMultiple(Integer<std::uint8_t,Safe::Wrap>(1),259)==0U);
+			CHECK(Safe::RoundUpToMultiple(Integer<std::int8_t,Safe::Saturate>(1),-1000)==0);
+		
+		}
+		
+		THEN("Alignments which are out of range of the integer's type are reported as invalid") {
+		
+			try {
+			
+				Safe::AlignUp(std::uint8_t(1),256);
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::Align);
+			
+			}
+		
+		}
+	
+	}
+	
+	GIVEN("An arbitrary divisor") {
+	
+		THEN("Quotients are rounded toward negative and positive infinity") {
+		
+			CHECK(Safe::DivFloor(7,2)==3);
+			CHECK(Safe::DivCeil(7,2)==4);
+			CHECK(Safe::DivFloor(-7,2)==-4);
+			CHECK(Safe::DivCeil(-7,2)==-3);
+			CHECK(Safe::DivFloor(7,-3)==-3);
+			CHECK(Safe::DivCeil(7,-3)==-2);
+			CHECK(Safe::DivCeil(Safe::size_t(std::numeric_limits<std::size_t>::max()),3)==(std::numeric_limits<std::size_t>::max()/3));
+			CHECK(Safe::DivCeil(Safe::size_t(std::numeric_limits<std::size_t>::max()),2)==((std::numeric_limits<std::size_t>::max()/2)+1));
+		
+		}
+		
+		THEN("Integers are rounded up to multiples of it") {
+		
+			CHECK(Safe::RoundUpToMultiple(Safe::size_t(13),12)==24);
+			CHECK(Safe::RoundUpToMultiple(Safe::size_t(24),12)==24);
+			CHECK(Safe::RoundUpToMultiple(-13,12)==-12);
+			CHECK(Safe::RoundUpToMultiple(Safe::size_t(13),4)==16);
+		
+		}
+		
+		THEN("Dividing by zero or rounding past the largest multiple throws") {
+		
+			REQUIRE_THROWS_AS(Safe::DivCeil(Safe::size_t(1),0),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::DivFloor(std::numeric_limits<int>::min(),-1),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::RoundUpToMultiple(std::numeric_limits<std::size_t>::max(),7),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::RoundUpToMultiple(Safe::size_t(13),0),std::overflow_error);
+			REQUIRE_THROWS_AS(Safe::RoundUpToMultiple(13,-12),std::overflow_error);
+		
+		}
+		
+		THEN("Divisors which are out of range of the dividend's type divide exactly") {
+		
+			CHECK(Safe::DivFloor(Integer<std::int8_t>(-100),1000)==-1);
+			CHECK(Safe::DivCeil(Integer<std::int8_t>(-100),1000)==0);
+			CHECK(Safe::DivCeil(std::int8_t(-128),128)==-1);
+			CHECK(Safe::DivFloor(Integer<std::uint8_t>(0),-3)==0U);
+			REQUIRE_THROWS_AS(Safe::DivFloor(Integer<std::uint8_t>(10),-3),std::overflow_error);
+		
+		}
+		
+		THEN("Dividing by divisors which are out of range of the dividend's type follows the policy") {
+		
+			CHECK(Safe::DivFloor(Integer<std::uint8_t,Safe::Saturate>(10),-3)==0U);
+			CHECK(Safe::DivCeil(Integer<std::uint8_t,Safe::Saturate>(10),-3)==0U);
+			CHECK(Safe::DivFloor(Integer<std::int8_t,Safe::Wrap>(100),1000)==0);
+			CHECK(Safe::DivCeil(Integer<std::int8_t,Safe::Wrap>(100),1000)==1);
+			CHECK(Safe::DivFloor(Integer<std::uint8_t,Safe::Wrap>(10),-3)==252U);
+		
+		}
+		
+		THEN("Dividing by zero with a policy other than throwing follows the policy") {
+		
+			CHECK(Safe::DivFloor(Integer<int,Safe::Saturate>(-5),0)==std::numeric_limits<int>::min());
+			CHECK(Safe::DivCeil(Integer<int,Safe::Saturate>(5),0)==std::numeric_limits<int>::max());
+			CHECK(Safe::DivFloor(Integer<int,Safe::Saturate>(0),0)==0);
+		
+		}
+		
+		THEN("The exception thrown describes the operation") {
+		
+			try {
+			
+				Safe::RoundUpToMultiple(std::uint8_t(254),std::uint8_t(7));
+				FAIL("No exception was thrown");
+			
+			} catch (const Safe::OverflowError & ex) {
+			
+				CHECK(ex.GetOperation()==Safe::Operation::RoundToMultiple);
+				CHECK(std::string(ex.what())=="Integer value out of range (round to multiple of 254 and 7 in 8 bit unsigned)");
+			
+			}
+		
+		}
+	
+	}
+
+}